@@ -40,8 +40,22 @@
 #include "Map.h"
 #include "ScriptMgr.h"
 #include "Language.h"
+#include "GameTime.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <limits>
+#include <memory>
 #include "DungeonScale.h"
+#include "DungeonScaleEngine.h"
+#include "DungeonScaleMetrics.h"
+#include "DungeonScalePerf.h"
+#include "DungeonScaleProbes.h"
+#include "DungeonScaleRecorder.h"
+#include "DungeonScaleTrace.h"
 #include "ScriptMgrMacros.h"
 #include "Group.h"
 #include "Log.h"
@@ -59,12 +73,7 @@ enum ScalingMethod {
     DUNGEONSCALE_SCALING_DYNAMIC
 };
 
-enum BaseValueType {
-    DUNGEONSCALE_HEALTH,
-    DUNGEONSCALE_DAMAGE_HEALING
-};
-
-enum Relevance {
+enum Relevance : uint8 {
     DUNGEONSCALE_RELEVANCE_FALSE,
     DUNGEONSCALE_RELEVANCE_TRUE,
     DUNGEONSCALE_RELEVANCE_UNCHECKED
@@ -75,6 +84,29 @@ enum Damage_Healing_Debug_Phase {
     DUNGEONSCALE_DAMAGE_HEALING_DEBUG_PHASE_AFTER
 };
 
+// why a map's creatures were rescaled, see `.dungeonscale history`
+enum DungeonScaleRescaleTrigger : uint8 {
+    DUNGEONSCALE_RESCALE_TRIGGER_NONE = 0,
+    DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_JOIN,
+    DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_LEAVE,
+    DUNGEONSCALE_RESCALE_TRIGGER_SET_PLAYERS,
+    DUNGEONSCALE_RESCALE_TRIGGER_CONFIG_RELOAD,
+    DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_LEVEL,
+    DUNGEONSCALE_RESCALE_TRIGGER_MAP_LEVEL,
+    DUNGEONSCALE_RESCALE_TRIGGER_COMBAT_LOCK_LIFTED,
+    DUNGEONSCALE_RESCALE_TRIGGER_ENABLED_STATE,
+    DUNGEONSCALE_RESCALE_TRIGGER_MAP_CREATED
+};
+
+// how close the nearest player is to an out-of-date creature, see IsCreatureRescaleDue
+enum DungeonScalePlayerProximity : uint8 {
+    DUNGEONSCALE_PROXIMITY_NONE = 0,
+    DUNGEONSCALE_PROXIMITY_IN_RANGE,
+    DUNGEONSCALE_PROXIMITY_CLOSE
+};
+
+constexpr uint8 DUNGEONSCALE_RESCALE_HISTORY_SIZE = 16;
+
 DungeonScaleScriptMgr* DungeonScaleScriptMgr::instance()
 {
     static DungeonScaleScriptMgr instance;
@@ -136,38 +168,112 @@ class DungeonScaleCreatureInfo : public DataMap::Base
 {
 public:
     DungeonScaleCreatureInfo() {}
+    DungeonScaleCreatureInfo(Relevance relevance) : relevance(relevance) {}
+
+    // return the record to its defaults in place, keeping what is known about the creature itself
+    void ResetScaling()
+    {
+        uint8 unmodifiedLevel = UnmodifiedLevel;
+        bool wasActive = isActive;
+        bool wasDead = wasAliveNowDead;
+        bool wasInCreatureList = isInCreatureList;
+        bool wasBoss = isBoss;
+        bool wasBossResolved = isBossResolved;
+
+        *this = DungeonScaleCreatureInfo();
+
+        UnmodifiedLevel = unmodifiedLevel;
+        isActive = wasActive;
+        wasAliveNowDead = wasDead;
+        isInCreatureList = wasInCreatureList;
+        isBoss = wasBoss;
+        isBossResolved = wasBossResolved;
+    }
 
     uint64_t mapConfigTime = 1;                     // the last map config time that this creature was updated
 
-    uint32 instancePlayerCount = 0;                 // the number of players this creature has been scaled for
-    uint8 selectedLevel = 0;                        // the level that this creature should be set to
+    ObjectGuid summonerGUID;                        // the creature that summoned this creature (resolved on demand)
 
     float DamageMultiplier = 1.0f;                  // per-player damage multiplier
-    float HealthMultiplier = 1.0f;                  // per-player health multiplier
-    float ManaMultiplier = 1.0f;                    // per-player mana multiplier
-    float ArmorMultiplier = 1.0f;                   // per-player armor multiplier
-
     float CCDurationMultiplier = 1.0f;              // per-player crowd control duration multiplier (level scaling doesn't affect this)
 
     float XPModifier = 1.0f;                        // per-player XP modifier (level scaling provided by normal XP distribution)
     float MoneyModifier = 1.0f;                     // per-player money modifier (no level scaling)
 
+    uint32 initialMaxHealth = 0;                    // stored max health value to be applied just before being added to the world
+
+    uint8 instancePlayerCount = 0;                  // the number of players this creature has been scaled for
+    uint8 selectedLevel = 0;                        // the level that this creature should be set to
     uint8 UnmodifiedLevel = 0;                      // original level of the creature as determined by the game
 
-    bool isActive = false;                          // whether or not the current creature is affecting map stats. May change as conditions change.
-    bool wasAliveNowDead = false;                   // whether or not the creature was alive and is now dead
-    bool isInCreatureList = false;                  // whether or not the creature is in the map's creature list
-    bool isBrandNew = false;                        // whether or not the creature is brand new to the map (hasn't been added to the world yet)
-    bool neverLevelScale = false;                   // whether or not the creature should never be level scaled (can still be player scaled)
+    Relevance relevance = DUNGEONSCALE_RELEVANCE_UNCHECKED;  // whether or not the creature is relevant for scaling
 
-    uint32 initialMaxHealth = 0;                    // stored max health value to be applied just before being added to the world
+    bool isActive : 1 = false;                      // whether or not the current creature is affecting map stats. May change as conditions change.
+    bool wasAliveNowDead : 1 = false;               // whether or not the creature was alive and is now dead
+    bool isInCreatureList : 1 = false;              // whether or not the creature is in the map's creature list
+    bool isBrandNew : 1 = false;                    // whether or not the creature is brand new to the map (hasn't been added to the world yet)
+    bool neverLevelScale : 1 = false;               // whether or not the creature should never be level scaled (can still be player scaled)
+    bool isCloneOfSummoner : 1 = false;             // whether or not the creature is a clone of its summoner
+    bool isBoss : 1 = false;                        // whether or not the creature is a boss or a boss summon (see isBossResolved)
+    bool isBossResolved : 1 = false;                // whether or not isBoss has been resolved for the current summoner
+    bool isAwaitingScaledStats : 1 = false;         // reset for a rescale, but the new stats haven't been written yet
+    bool isRescaleDeferred : 1 = false;             // out of date, but left alone until a player comes within range of it
+
+    // the health, mana and armor multipliers are not stored, `.dungeonscale getcreaturestat` derives them from the creature's stats
+};
 
-    // creature->IsSummon()                         // whether or not the creature is a summon
-    Creature* summoner = nullptr;                   // the creature that summoned this creature
-    std::string summonerName = "";                  // the name of the creature that summoned this creature
-    bool isCloneOfSummoner = false;                 // whether or not the creature is a clone of its summoner
+// shared, read-only record returned for creatures that were found not to be relevant and had their own record released
+static DungeonScaleCreatureInfo const notRelevantCreatureInfo(DUNGEONSCALE_RELEVANCE_FALSE);
 
-    Relevance relevance = DUNGEONSCALE_RELEVANCE_UNCHECKED;  // whether or not the creature is relevant for scaling
+// original (unscaled) stats of a creature template at a given level
+class DungeonScaleBaseStats
+{
+public:
+    uint32 health = 0;
+    uint32 mana = 0;
+    uint32 armor = 0;
+};
+
+// original stats of a creature template across its level range, indexed by (level - minLevel)
+class DungeonScaleTemplateBaseStats
+{
+public:
+    uint8 minLevel = 0;
+    std::vector<DungeonScaleBaseStats> levels;
+};
+
+// what the first summon of an entry by a given summoner resolved to, reused by later identical summons
+class DungeonScaleSummonProfile
+{
+public:
+    uint64_t mapConfigTime = 0;                     // the map config time this profile was computed for
+    uint8 adjustedPlayerCount = 0;                  // the map's adjusted player count this profile was computed for
+    uint8 spawnLevel = 0;                           // the level the summon was spawned at
+    uint8 UnmodifiedLevel = 0;                      // the original level resolved for the summon
+    bool neverLevelScale = false;
+    bool isBoss = false;
+
+    // stat inputs, filled by the first full ModifyCreatureAttributes run for this profile
+    bool hasStats = false;
+    float defaultMultiplier = 1.0f;                 // before `OnAfterDefaultMultiplier`
+    DungeonScaleStatModifiers statModifiers;
+};
+
+// one reconfiguration of a map and the creature rescales that followed it
+class DungeonScaleRescaleWave
+{
+public:
+    uint64 startTime = 0;                           // steady clock (ms) when the map was reconfigured
+    uint64 lastRescaleTime = 0;                     // steady clock (ms) when the last creature of the wave was rescaled
+    uint64 lastTickTime = 0;                        // game time (ms) of the last update tick that rescaled a creature
+    uint64 rescaleTimeNs = 0;                       // wall time spent resetting and rescaling the wave's creatures
+    uint32 creaturesReset = 0;                      // creatures reset for a rescale
+    uint32 creaturesRestored = 0;                   // reset creatures that went back to their original stats instead
+    uint32 creaturesDeferred = 0;                   // creatures left alone until a player gets near
+    uint16 ticks = 0;                               // update ticks the rescales were spread across
+    DungeonScaleRescaleTrigger trigger = DUNGEONSCALE_RESCALE_TRIGGER_NONE;
+    uint8 adjustedPlayerCount = 0;                  // the difficulty the wave rescaled to
+    uint8 mapLevel = 0;                             // the map level the wave rescaled to
 };
 
 class DungeonScaleMapInfo : public DataMap::Base
@@ -183,6 +289,9 @@ public:
     uint8 overridePlayerCount = 0;                   // override difficulty if set
     uint8 minPlayers = 1;                            // will be set by the config
 
+    uint8 pendingAdjustedPlayerCount = 0;            // a debounced difficulty change waiting to become stable, 0 if none
+    uint64 pendingAdjustedPlayerCountTime = 0;       // game time (ms) the pending difficulty was first seen
+
     uint8 mapLevel = 0;                              // calculated from the avgCreatureLevel
     uint8 lowestPlayerLevel = 0;                     // the lowest-level player in the map
     uint8 highestPlayerLevel = 0;                    // the highest-level player in the map
@@ -190,16 +299,31 @@ public:
     uint8 lfgMinLevel = 0;                           // the minimum level for the map according to LFG
     uint8 lfgTargetLevel = 0;                        // the target level for the map according to LFG
     uint8 lfgMaxLevel = 0;                           // the maximum level for the map according to LFG
+    uint8 lfgMinLevelBound = 0;                      // 85% of lfgMinLevel, creatures below are considered flavor creatures
+    uint8 lfgMaxLevelBound = 0;                      // 115% of lfgMaxLevel, creatures above are considered flavor creatures
 
     uint8 worldMultiplierTargetLevel = 0;            // the level of the pseudo-creature that the world modifiers scale to
     float worldDamageHealingMultiplier = 1.0f;       // the damage/healing multiplier for the world (where source isn't an enemy creature)
     float worldHealthMultiplier = 1.0f;              // the "health" multiplier for any destructible buildings in the map
+    uint8 worldMultiplierPlayerCount = 0;            // the adjusted player count the world multipliers were calculated for, 0 if defaults
+    uint64_t worldMultiplierConfigTime = 0;          // the global config time the world multipliers were calculated for
+
+    bool rewardScalingXP = false;                    // reward profile: should XP be scaled in this map?
+    bool rewardScalingMoney = false;                 // reward profile: should money be scaled in this map?
+    float rewardFixedXPRatio = 1.0f;                 // reward profile: playerCount / maxPlayers, used by the fixed scaling method
+    float rewardFixedMoneyRatio = 1.0f;              // reward profile: adjustedPlayerCount / maxPlayers, used by the fixed scaling method
+    std::unordered_map<ObjectGuid, float> lootMoneyModifiers; // money modifiers of killed creatures, keyed by the loot's source GUID
 
     bool enabled = false;                            // should DungeonScale make any changes to this map or its creatures?
+    bool isDormant = false;                          // no non-GM players left, per-creature updates are skipped until one enters
 
     std::vector<Creature*> allMapCreatures;          // all creatures in the map, active and non-active
+    std::unordered_set<ObjectGuid> notRelevantCreatures; // creatures that aren't relevant and had their DungeonScaleCreatureInfo released
     std::vector<Player*> allMapPlayers;              // all players that are currently in the map
 
+    std::unordered_map<uint64, int8> cloneStaticScores; // clone score from entry, type and name, keyed by (summon entry << 32 | summoner entry)
+    std::unordered_map<uint64, DungeonScaleSummonProfile> summonProfiles; // keyed by (summon entry << 32 | summoner GUID counter)
+
     bool combatLocked = false;                       // whether or not the map is combat locked
     bool combatLockTripped = false;                  // set to true when combat locking was needed during this current combat (some tried to leave)
     uint8 combatLockMinPlayers = 0;                  // the instance cannot be set to less than this number of players until combat ends
@@ -210,31 +334,58 @@ public:
     uint32 activeCreatureCount = 0;                  // the number of creatures in the map that are included in the map's stats (not necessarily alive)
 
     uint8 prevMapLevel = 0;                          // used to reduce calculations when they are not necessary
+
+    uint64 rescaleTickTime = 0;                      // game time (ms) of the update tick the rescale budget was last refilled for
+    uint32 rescalesThisTick = 0;                     // out-of-combat creatures rescaled during that tick
+    uint32 closeRescalesRefused = 0;                 // close creatures that found the budget used up during that tick
+    uint32 closeRescalesWaiting = 0;                 // the same count for the tick before, farther creatures wait while it isn't 0
+
+    float nearPlayerRange = 0.0f;                    // the map's visibility range when the players' bounds were collected
+    float nearPlayerMinX = 0.0f;                     // the players' positions during the rescale tick, widened by nearPlayerRange
+    float nearPlayerMaxX = 0.0f;
+    float nearPlayerMinY = 0.0f;
+    float nearPlayerMaxY = 0.0f;
+
+    uint32 rescalesPerformed = 0;                    // creatures rescaled since the map was created
+    uint32 rescalesDeferred = 0;                     // out-of-date creatures held back because no player was within range
+    uint32 rescalesAvoided = 0;                      // deferred creatures that died or left the map before they had to be rescaled
+
+    DungeonScaleRescaleTrigger pendingRescaleTrigger = DUNGEONSCALE_RESCALE_TRIGGER_NONE; // why the next wave will happen
+    std::array<DungeonScaleRescaleWave, DUNGEONSCALE_RESCALE_HISTORY_SIZE> rescaleHistory; // ring buffer of the last waves
+    uint8 rescaleHistoryNext = 0;                    // where the next wave is recorded
+    uint8 rescaleHistoryCount = 0;                   // waves recorded so far, up to DUNGEONSCALE_RESCALE_HISTORY_SIZE
+
+    uint32 publishedTrackedCreatures = 0;            // what this map last added to the metrics gauges, taken back out when it changes
+    uint32 publishedActiveCreatures = 0;
+    bool publishedCombatLocked = false;
+    int8 publishedInstanceType = -1;                 // the category counted as an enabled instance, -1 when none
+    bool isMetricsPublished = false;                 // any of the above is in the gauges, see MetricsPublishedMaps
+
+    std::unique_ptr<DungeonScaleRecorder> recorder;  // only created for new instances while DungeonScale.Recorder.Enable is on
+    uint32 recordingSaves = 0;                       // numbers the recording files, so saves within the same second don't overwrite each other
 };
 
-class DungeonScaleStatModifiers : public DataMap::Base
+// classification that only depends on the creature template and the config, resolved once per entry
+class DungeonScaleCreatureTemplateInfo
 {
 public:
-    DungeonScaleStatModifiers() {}
-    DungeonScaleStatModifiers(float global, float health, float mana, float armor, float damage, float ccduration) :
-        global(global), health(health), mana(mana), armor(armor), damage(damage), ccduration(ccduration) {}
-    float global;
-    float health;
-    float mana;
-    float armor;
-    float damage;
-    float ccduration;
+    int forcedNumPlayers = -1;                                      // -1 if not in a DungeonScale.ForcedID* list
+    DungeonScaleStatModifiers const* creatureOverride = nullptr;    // DungeonScale.StatModifier.PerCreature entry, if any
+
+    bool isCritter : 1 = false;
+    bool isTrigger : 1 = false;
 };
 
-class DungeonScaleInflectionPointSettings : public DataMap::Base
+// LFG level range of a map at a difficulty, with the creature level bounds derived from it
+class DungeonScaleLFGLevels
 {
 public:
-    DungeonScaleInflectionPointSettings() {}
-    DungeonScaleInflectionPointSettings(float value, float curveFloor, float curveCeiling) :
-        value(value), curveFloor(curveFloor), curveCeiling(curveCeiling) {}
-    float value;
-    float curveFloor;
-    float curveCeiling;
+    uint8 minLevel = 0;
+    uint8 maxLevel = 0;
+    uint8 targetLevel = 0;
+    uint8 minLevelBound = 0;                                        // 85% of minLevel, rounded
+    uint8 maxLevelBound = 0;                                        // 115% of maxLevel, rounded
+    bool isFromNormalDifficulty = false;                            // heroic difficulty not in LFG, taken from the normal one
 };
 
 uint64_t GetCurrentConfigTime()
@@ -242,50 +393,13 @@ uint64_t GetCurrentConfigTime()
     return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 }
 
-// spell IDs that spend player health
-// player abilities don't actually appear to be caught by `ModifySpellDamageTaken`,
-// but I'm leaving them here in case they ever DO get caught by it
-static std::list<uint32> spellIdsThatSpendPlayerHealth =
-{
-    45529,      // Blood Tap
-    2687,       // Bloodrage
-    27869,      // Dark Rune
-    16666,      // Demonic Rune
-    755,        // Health Funnel (Rank 1)
-    3698,       // Health Funnel (Rank 2)
-    3699,       // Health Funnel (Rank 3)
-    3700,       // Health Funnel (Rank 4)
-    11693,      // Health Funnel (Rank 5)
-    11694,      // Health Funnel (Rank 6)
-    11695,      // Health Funnel (Rank 7)
-    27259,      // Health Funnel (Rank 8)
-    47856,      // Health Funnel (Rank 9)
-    1454,       // Life Tap (Rank 1)
-    1455,       // Life Tap (Rank 2)
-    1456,       // Life Tap (Rank 3)
-    11687,      // Life Tap (Rank 4)
-    11688,      // Life Tap (Rank 5)
-    11689,      // Life Tap (Rank 6)
-    27222,      // Life Tap (Rank 7)
-    57946,      // Life Tap (Rank 8)
-    29858,      // Soulshatter
-    55213       // Unholy Frenzy
-};
-
 // creature IDs that should never be considered clones
 // handles cases where a creature is spawned by another creature, but is not a clone (doesn't retain health/mana values)
-static std::list<uint32> creatureIDsThatAreNotClones =
+static std::unordered_set<uint32> creatureIDsThatAreNotClones =
 {
     16152       // Attumen the Huntsman (Karazhan) combined form
 };
 
-// spell IDs that should never be modified
-// handles cases where a spell is reflecting damage or otherwise converting player damage to something else
-static std::list<uint32> spellIdsToNeverModify =
-{
-    1177        // Twin Empathy (AQ40 Twin Emperors, only in `spell_dbc` database table)
-};
-
 // spacer used for logging
 std::string SPACER = "------------------------------------------------";
 
@@ -296,25 +410,44 @@ static uint32 minPlayersNormal, minPlayersHeroic;
 static std::map<uint32, uint8> minPlayersPerDungeonIdMap;
 static std::map<uint32, uint8> minPlayersPerHeroicDungeonIdMap;
 
-static std::map<uint32, DungeonScaleInflectionPointSettings> dungeonOverrides;
-static std::map<uint32, DungeonScaleInflectionPointSettings> bossOverrides;
-static std::map<uint32, DungeonScaleStatModifiers> statModifierOverrides;
-static std::map<uint32, DungeonScaleStatModifiers> statModifierBossOverrides;
-static std::map<uint32, DungeonScaleStatModifiers> statModifierCreatureOverrides;
+// only entries that differ from the default are stored, everything else resolves to defaultCreatureTemplateInfo
+static std::unordered_map<uint32, DungeonScaleCreatureTemplateInfo> creatureTemplateInfos;
+static DungeonScaleCreatureTemplateInfo const defaultCreatureTemplateInfo;
+
+// original health, mana and armor of every creature template over its level range, keyed by entry
+// built along with the classification and read-only while the maps update, so it's shared without a lock
+static std::unordered_map<uint32, DungeonScaleTemplateBaseStats> creatureBaseStats;
+
+// resolved once at startup, keyed by (mapId << 8 | difficulty)
+static std::unordered_map<uint32, DungeonScaleLFGLevels> lfgLevelsByMapDifficulty;
 
-static int8 PlayerCountDifficultyOffset;
 static bool Announcement;
 static bool PlayerChangeNotify;
-static float MinHPModifier, MinManaModifier, MinDamageModifier, MinCCDurationModifier, MaxCCDurationModifier;
 
 // RewardScaling.*
 static ScalingMethod RewardScalingMethod;
 static bool RewardScalingXP, RewardScalingMoney;
 static float RewardScalingXPModifier, RewardScalingMoneyModifier;
-static bool RewardScalingLoot, RewardScalingLootBOPAlwaysDropException;
-static std::list<uint32> RewardScalingExceptionItemIDs;
-static bool RewardScalingExemptContainers;
-static bool RewardScalingExemptSkinning;
+
+// Rescale.*
+static bool RescaleDeferDistant;
+static uint32 RescaleMaxPerTick;
+
+// Metrics.*
+static bool MetricsExportRunning = false;
+static std::string MetricsFile;
+static uint32 MetricsInterval;
+static std::atomic<uint32> MetricsPublishedMaps{0};   // maps with a contribution in the metrics gauges, taken back out after the export stops
+
+// Recorder.*
+static bool RecorderEnable;
+static uint32 RecorderRecords;
+static std::string RecorderDirectory;
+
+// Trace.*
+static std::string TraceFile;
+
+// PlayerCount.*
 
 // Track the initial config time
 static uint64_t globalConfigTime = GetCurrentConfigTime();
@@ -325,181 +458,8 @@ static bool Enable5M, Enable10M, Enable15M, Enable20M, Enable25M, Enable40M;
 static bool Enable5MHeroic, Enable10MHeroic, Enable25MHeroic;
 static bool EnableOtherNormal, EnableOtherHeroic;
 
-// InflectionPoint*
-static float InflectionPoint, InflectionPointCurveFloor, InflectionPointCurveCeiling, InflectionPointBoss;
-static float InflectionPointHeroic, InflectionPointHeroicCurveFloor, InflectionPointHeroicCurveCeiling, InflectionPointHeroicBoss;
-static float InflectionPointRaid, InflectionPointRaidCurveFloor, InflectionPointRaidCurveCeiling, InflectionPointRaidBoss;
-static float InflectionPointRaidHeroic, InflectionPointRaidHeroicCurveFloor, InflectionPointRaidHeroicCurveCeiling, InflectionPointRaidHeroicBoss;
-
-static float InflectionPointRaid10M, InflectionPointRaid10MCurveFloor, InflectionPointRaid10MCurveCeiling, InflectionPointRaid10MBoss;
-static float InflectionPointRaid10MHeroic, InflectionPointRaid10MHeroicCurveFloor, InflectionPointRaid10MHeroicCurveCeiling, InflectionPointRaid10MHeroicBoss;
-static float InflectionPointRaid15M, InflectionPointRaid15MCurveFloor, InflectionPointRaid15MCurveCeiling, InflectionPointRaid15MBoss;
-static float InflectionPointRaid20M, InflectionPointRaid20MCurveFloor, InflectionPointRaid20MCurveCeiling, InflectionPointRaid20MBoss;
-static float InflectionPointRaid25M, InflectionPointRaid25MCurveFloor, InflectionPointRaid25MCurveCeiling, InflectionPointRaid25MBoss;
-static float InflectionPointRaid25MHeroic, InflectionPointRaid25MHeroicCurveFloor, InflectionPointRaid25MHeroicCurveCeiling, InflectionPointRaid25MHeroicBoss;
-static float InflectionPointRaid40M, InflectionPointRaid40MCurveFloor, InflectionPointRaid40MCurveCeiling, InflectionPointRaid40MBoss;
-
-// StatModifier*
-static float StatModifier_Global, StatModifier_Health, StatModifier_Mana, StatModifier_Armor, StatModifier_Damage, StatModifier_CCDuration;
-static float StatModifierHeroic_Global, StatModifierHeroic_Health, StatModifierHeroic_Mana, StatModifierHeroic_Armor, StatModifierHeroic_Damage, StatModifierHeroic_CCDuration;
-static float StatModifierRaid_Global, StatModifierRaid_Health, StatModifierRaid_Mana, StatModifierRaid_Armor, StatModifierRaid_Damage, StatModifierRaid_CCDuration;
-static float StatModifierRaidHeroic_Global, StatModifierRaidHeroic_Health, StatModifierRaidHeroic_Mana, StatModifierRaidHeroic_Armor, StatModifierRaidHeroic_Damage, StatModifierRaidHeroic_CCDuration;
-
-static float StatModifierRaid10M_Global, StatModifierRaid10M_Health, StatModifierRaid10M_Mana, StatModifierRaid10M_Armor, StatModifierRaid10M_Damage, StatModifierRaid10M_CCDuration;
-static float StatModifierRaid10MHeroic_Global, StatModifierRaid10MHeroic_Health, StatModifierRaid10MHeroic_Mana, StatModifierRaid10MHeroic_Armor, StatModifierRaid10MHeroic_Damage, StatModifierRaid10MHeroic_CCDuration;
-static float StatModifierRaid15M_Global, StatModifierRaid15M_Health, StatModifierRaid15M_Mana, StatModifierRaid15M_Armor, StatModifierRaid15M_Damage, StatModifierRaid15M_CCDuration;
-static float StatModifierRaid20M_Global, StatModifierRaid20M_Health, StatModifierRaid20M_Mana, StatModifierRaid20M_Armor, StatModifierRaid20M_Damage, StatModifierRaid20M_CCDuration;
-static float StatModifierRaid25M_Global, StatModifierRaid25M_Health, StatModifierRaid25M_Mana, StatModifierRaid25M_Armor, StatModifierRaid25M_Damage, StatModifierRaid25M_CCDuration;
-static float StatModifierRaid25MHeroic_Global, StatModifierRaid25MHeroic_Health, StatModifierRaid25MHeroic_Mana, StatModifierRaid25MHeroic_Armor, StatModifierRaid25MHeroic_Damage, StatModifierRaid25MHeroic_CCDuration;
-static float StatModifierRaid40M_Global, StatModifierRaid40M_Health, StatModifierRaid40M_Mana, StatModifierRaid40M_Armor, StatModifierRaid40M_Damage, StatModifierRaid40M_CCDuration;
-
-// StatModifier* (Boss)
-static float StatModifier_Boss_Global, StatModifier_Boss_Health, StatModifier_Boss_Mana, StatModifier_Boss_Armor, StatModifier_Boss_Damage, StatModifier_Boss_CCDuration;
-static float StatModifierHeroic_Boss_Global, StatModifierHeroic_Boss_Health, StatModifierHeroic_Boss_Mana, StatModifierHeroic_Boss_Armor, StatModifierHeroic_Boss_Damage, StatModifierHeroic_Boss_CCDuration;
-static float StatModifierRaid_Boss_Global, StatModifierRaid_Boss_Health, StatModifierRaid_Boss_Mana, StatModifierRaid_Boss_Armor, StatModifierRaid_Boss_Damage, StatModifierRaid_Boss_CCDuration;
-static float StatModifierRaidHeroic_Boss_Global, StatModifierRaidHeroic_Boss_Health, StatModifierRaidHeroic_Boss_Mana, StatModifierRaidHeroic_Boss_Armor, StatModifierRaidHeroic_Boss_Damage, StatModifierRaidHeroic_Boss_CCDuration;
-
-static float StatModifierRaid10M_Boss_Global, StatModifierRaid10M_Boss_Health, StatModifierRaid10M_Boss_Mana, StatModifierRaid10M_Boss_Armor, StatModifierRaid10M_Boss_Damage, StatModifierRaid10M_Boss_CCDuration;
-static float StatModifierRaid10MHeroic_Boss_Global, StatModifierRaid10MHeroic_Boss_Health, StatModifierRaid10MHeroic_Boss_Mana, StatModifierRaid10MHeroic_Boss_Armor, StatModifierRaid10MHeroic_Boss_Damage, StatModifierRaid10MHeroic_Boss_CCDuration;
-static float StatModifierRaid15M_Boss_Global, StatModifierRaid15M_Boss_Health, StatModifierRaid15M_Boss_Mana, StatModifierRaid15M_Boss_Armor, StatModifierRaid15M_Boss_Damage, StatModifierRaid15M_Boss_CCDuration;
-static float StatModifierRaid20M_Boss_Global, StatModifierRaid20M_Boss_Health, StatModifierRaid20M_Boss_Mana, StatModifierRaid20M_Boss_Armor, StatModifierRaid20M_Boss_Damage, StatModifierRaid20M_Boss_CCDuration;
-static float StatModifierRaid25M_Boss_Global, StatModifierRaid25M_Boss_Health, StatModifierRaid25M_Boss_Mana, StatModifierRaid25M_Boss_Armor, StatModifierRaid25M_Boss_Damage, StatModifierRaid25M_Boss_CCDuration;
-static float StatModifierRaid25MHeroic_Boss_Global, StatModifierRaid25MHeroic_Boss_Health, StatModifierRaid25MHeroic_Boss_Mana, StatModifierRaid25MHeroic_Boss_Armor, StatModifierRaid25MHeroic_Boss_Damage, StatModifierRaid25MHeroic_Boss_CCDuration;
-static float StatModifierRaid40M_Boss_Global, StatModifierRaid40M_Boss_Health, StatModifierRaid40M_Boss_Mana, StatModifierRaid40M_Boss_Armor, StatModifierRaid40M_Boss_Damage, StatModifierRaid40M_Boss_CCDuration;
-
-std::list<uint32> ParseIntsFromString(std::string inputString) // Used when parsing strings that have comma delimited ints
-{
-    std::string delimitedValue;
-    std::stringstream intStringStream;
-    std::list<uint32> returnIntList;
-
-    intStringStream.str(inputString);
-    while (std::getline(intStringStream, delimitedValue, ',')) // Process each int in the string, delimited by the comma - ","
-    {
-        std::string valueOne;
-        std::stringstream intStream(delimitedValue);
-        intStream >>valueOne;
-        auto intValue = atoi(valueOne.c_str());
-        returnIntList.push_back(intValue);
-    }
-
-    return returnIntList;
-}
-
-std::map<uint32, uint8> LoadMinPlayersPerDungeonId(std::string minPlayersString) // Used for reading the string from the configuration file for per-dungeon minimum player count overrides
-{
-    std::string delimitedValue;
-    std::stringstream dungeonIdStream;
-    std::map<uint32, uint8> dungeonIdMap;
-
-    dungeonIdStream.str(minPlayersString);
-    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
-    {
-        std::string val1, val2;
-        std::stringstream dungeonPairStream(delimitedValue);
-        dungeonPairStream >> val1 >> val2;
-        auto dungeonMapId = atoi(val1.c_str());
-        auto minPlayers = atoi(val2.c_str());
-        dungeonIdMap[dungeonMapId] = minPlayers;
-    }
-
-    return dungeonIdMap;
-}
-
-std::map<uint32, DungeonScaleInflectionPointSettings> LoadInflectionPointOverrides(std::string dungeonIdString) // Used for reading the string from the configuration file for selecting dungeons to override
-{
-    std::string delimitedValue;
-    std::stringstream dungeonIdStream;
-    std::map<uint32, DungeonScaleInflectionPointSettings> overrideMap;
-
-    dungeonIdStream.str(dungeonIdString);
-    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
-    {
-        std::string val1, val2, val3, val4;
-        std::stringstream dungeonPairStream(delimitedValue);
-        dungeonPairStream >> val1 >> val2 >> val3 >> val4;
-
-        auto dungeonMapId = atoi(val1.c_str());
-
-        // Replace any missing values with -1
-        if (val2.empty()) { val2 = "-1"; }
-        if (val3.empty()) { val3 = "-1"; }
-        if (val4.empty()) { val4 = "-1"; }
-
-        DungeonScaleInflectionPointSettings ipSettings = DungeonScaleInflectionPointSettings(
-            atof(val2.c_str()),
-            atof(val3.c_str()),
-            atof(val4.c_str())
-        );
-
-        overrideMap[dungeonMapId] = ipSettings;
-    }
-
-    return overrideMap;
-}
-
-std::map<uint32, DungeonScaleStatModifiers> LoadStatModifierOverrides(std::string dungeonIdString) // Used for reading the string from the configuration file for per-dungeon stat modifiers
-{
-    std::string delimitedValue;
-    std::stringstream dungeonIdStream;
-    std::map<uint32, DungeonScaleStatModifiers> overrideMap;
-
-    dungeonIdStream.str(dungeonIdString);
-    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
-    {
-        std::string val1, val2, val3, val4, val5, val6, val7;
-        std::stringstream dungeonStream(delimitedValue);
-        dungeonStream >> val1 >> val2 >> val3 >> val4 >> val5 >> val6 >> val7;
-
-        auto dungeonMapId = atoi(val1.c_str());
-
-        // Replace any missing values with -1
-        if (val2.empty()) { val2 = "-1"; }
-        if (val3.empty()) { val3 = "-1"; }
-        if (val4.empty()) { val4 = "-1"; }
-        if (val5.empty()) { val5 = "-1"; }
-        if (val6.empty()) { val6 = "-1"; }
-        if (val7.empty()) { val7 = "-1"; }
-
-        DungeonScaleStatModifiers statSettings = DungeonScaleStatModifiers(
-            atof(val2.c_str()),
-            atof(val3.c_str()),
-            atof(val4.c_str()),
-            atof(val5.c_str()),
-            atof(val6.c_str()),
-            atof(val7.c_str())
-        );
-
-        overrideMap[dungeonMapId] = statSettings;
-    }
-
-    return overrideMap;
-}
-
-std::map<uint32, uint32> LoadDistanceCheckOverrides(std::string dungeonIdString)
-{
-    std::string delimitedValue;
-    std::stringstream dungeonIdStream;
-    std::map<uint32, uint32> overrideMap;
-
-    dungeonIdStream.str(dungeonIdString);
-    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
-    {
-        std::string val1, val2;
-        std::stringstream dungeonStream(delimitedValue);
-        dungeonStream >> val1 >> val2;
-
-        auto dungeonMapId = atoi(val1.c_str());
-        overrideMap[dungeonMapId] = atoi(val2.c_str());
-    }
-
-    return overrideMap;
-}
-
-bool isIntInList(std::list<uint32> intList, uint32 intValue)
-{
-    return (std::find(intList.begin(), intList.end(), intValue) != intList.end());
-}
+// InflectionPoint*, StatModifier*, the per-instance and per-creature overrides and the loot exemptions
+static DungeonScaleEngineConfig engineConfig;
 
 bool isDungeonInMinPlayerMap(uint32 dungeonId, bool isHeroic)
 {
@@ -510,29 +470,15 @@ bool isDungeonInMinPlayerMap(uint32 dungeonId, bool isHeroic)
     }
 }
 
-bool hasDungeonOverride(uint32 dungeonId)
-{
-    return (dungeonOverrides.find(dungeonId) != dungeonOverrides.end());
-}
-
-bool hasBossOverride(uint32 dungeonId)
-{
-    return (bossOverrides.find(dungeonId) != bossOverrides.end());
-}
-
-bool hasStatModifierOverride(uint32 dungeonId)
+DungeonScaleCreatureTemplateInfo const& GetCreatureTemplateInfo(uint32 creatureId)
 {
-    return (statModifierOverrides.find(dungeonId) != statModifierOverrides.end());
+    auto templateInfoIterator = creatureTemplateInfos.find(creatureId);
+    return templateInfoIterator != creatureTemplateInfos.end() ? templateInfoIterator->second : defaultCreatureTemplateInfo;
 }
 
-bool hasStatModifierBossOverride(uint32 dungeonId)
+DungeonScaleCreatureTemplateInfo const& GetCreatureTemplateInfo(Creature* creature)
 {
-    return (statModifierBossOverrides.find(dungeonId) != statModifierBossOverrides.end());
-}
-
-bool hasStatModifierCreatureOverride(uint32 creatureId)
-{
-    return (statModifierCreatureOverrides.find(creatureId) != statModifierCreatureOverrides.end());
+    return GetCreatureTemplateInfo(creature->GetEntry());
 }
 
 bool ShouldMapBeEnabled(Map* map)
@@ -829,6 +775,350 @@ bool isBossOrBossSummon(Creature* creature, bool log = false)
     return false;
 }
 
+// get the unit's DS info without creating it, units without their own record share the read-only "not relevant" record
+DungeonScaleCreatureInfo const* GetCreatureInfo(Unit* unit)
+{
+    if (DungeonScaleCreatureInfo const* creatureDSInfo = unit->CustomData.Get<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo"))
+    {
+        return creatureDSInfo;
+    }
+
+    return &notRelevantCreatureInfo;
+}
+
+// resolve the boss flag into the creature's record so the scaling pipeline doesn't have to walk the summoner chain every time
+void ResolveCreatureBossFlag(Creature* creature, DungeonScaleCreatureInfo* creatureDSInfo)
+{
+    creatureDSInfo->isBoss = isBossOrBossSummon(creature);
+    creatureDSInfo->isBossResolved = true;
+}
+
+bool isBossOrBossSummonCached(Creature* creature)
+{
+    if (!creature)
+        return false;
+
+    DungeonScaleCreatureInfo* creatureDSInfo = creature->CustomData.Get<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+
+    // creatures without their own record aren't scaled, no point in caching anything for them
+    if (!creatureDSInfo)
+        return isBossOrBossSummon(creature);
+
+    if (!creatureDSInfo->isBossResolved)
+        ResolveCreatureBossFlag(creature, creatureDSInfo);
+
+    return creatureDSInfo->isBoss;
+}
+
+// generate the original health, mana and armor of the template at this level
+DungeonScaleBaseStats GenerateCreatureBaseStats(CreatureTemplate const* creatureTemplate, uint8 level)
+{
+    CreatureBaseStats const* classLevelStats = sObjectMgr->GetCreatureBaseStats(level, creatureTemplate->unit_class);
+
+    DungeonScaleBaseStats baseStats;
+    baseStats.health = classLevelStats->GenerateHealth(creatureTemplate);
+    baseStats.mana = classLevelStats->GenerateMana(creatureTemplate);
+    baseStats.armor = classLevelStats->GenerateArmor(creatureTemplate);
+
+    return baseStats;
+}
+
+// original health, mana and armor of the template at this level, from the table built in LoadCreatureTemplateInfo
+DungeonScaleBaseStats GetCreatureOriginalBaseStats(CreatureTemplate const* creatureTemplate, uint8 level)
+{
+    auto baseStatsIterator = creatureBaseStats.find(creatureTemplate->Entry);
+    if (baseStatsIterator != creatureBaseStats.end())
+    {
+        DungeonScaleTemplateBaseStats const& templateBaseStats = baseStatsIterator->second;
+
+        if (level >= templateBaseStats.minLevel && size_t(level - templateBaseStats.minLevel) < templateBaseStats.levels.size())
+            return templateBaseStats.levels[level - templateBaseStats.minLevel];
+    }
+
+    // the level was set outside of the template's range (by a script or the core), generate it without caching
+    return GenerateCreatureBaseStats(creatureTemplate, level);
+}
+
+// collect the area around the map's players once per update tick, so creatures outside of it don't each have to check their distance to every player
+// the players move during the same map update, so the area is a per-tick approximation of where they are
+void CollectNearPlayerBounds(Map* map, DungeonScaleMapInfo* mapDSInfo)
+{
+    mapDSInfo->nearPlayerRange = map->GetVisibilityRange();
+    mapDSInfo->nearPlayerMinX = mapDSInfo->nearPlayerMinY = std::numeric_limits<float>::max();
+    mapDSInfo->nearPlayerMaxX = mapDSInfo->nearPlayerMaxY = std::numeric_limits<float>::lowest();
+
+    for (Player* player : mapDSInfo->allMapPlayers)
+    {
+        mapDSInfo->nearPlayerMinX = std::min(mapDSInfo->nearPlayerMinX, player->GetPositionX() - mapDSInfo->nearPlayerRange);
+        mapDSInfo->nearPlayerMaxX = std::max(mapDSInfo->nearPlayerMaxX, player->GetPositionX() + mapDSInfo->nearPlayerRange);
+        mapDSInfo->nearPlayerMinY = std::min(mapDSInfo->nearPlayerMinY, player->GetPositionY() - mapDSInfo->nearPlayerRange);
+        mapDSInfo->nearPlayerMaxY = std::max(mapDSInfo->nearPlayerMaxY, player->GetPositionY() + mapDSInfo->nearPlayerRange);
+    }
+}
+
+// whether or not a player is within the map's visibility range or the creature's activation range, close enough to see (and engage) it
+// creatures within half of that range of a player are close, and go first when the rescale budget runs out
+// this is a distance check only, creatures are only updated in loaded grids so the grid state itself tells nothing here
+DungeonScalePlayerProximity GetCreaturePlayerProximity(Creature* creature, DungeonScaleMapInfo* mapDSInfo)
+{
+    Map* map = creature->GetMap();
+
+    float activationRange = std::max(map->GetVisibilityRange(), creature->GetGridActivationRange());
+
+    // most out-of-date creatures are nowhere near the players, rule those out without measuring the distance to each player
+    // creatures that see farther than the map's visibility range aren't covered by the bounds
+    if (activationRange <= mapDSInfo->nearPlayerRange && (
+        creature->GetPositionX() < mapDSInfo->nearPlayerMinX || creature->GetPositionX() > mapDSInfo->nearPlayerMaxX ||
+        creature->GetPositionY() < mapDSInfo->nearPlayerMinY || creature->GetPositionY() > mapDSInfo->nearPlayerMaxY))
+        return DUNGEONSCALE_PROXIMITY_NONE;
+
+    DungeonScalePlayerProximity proximity = DUNGEONSCALE_PROXIMITY_NONE;
+
+    for (Player* player : mapDSInfo->allMapPlayers)
+    {
+        if (!creature->IsInMap(player))
+            continue;
+
+        float distance = creature->GetDistance(player);
+
+        if (distance <= activationRange / 2)
+            return DUNGEONSCALE_PROXIMITY_CLOSE;
+
+        if (distance <= activationRange)
+            proximity = DUNGEONSCALE_PROXIMITY_IN_RANGE;
+    }
+
+    return proximity;
+}
+
+char const* GetRescaleTriggerName(DungeonScaleRescaleTrigger trigger)
+{
+    switch (trigger)
+    {
+        case DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_JOIN:          return "Player joined";
+        case DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_LEAVE:         return "Player left";
+        case DUNGEONSCALE_RESCALE_TRIGGER_SET_PLAYERS:          return "setplayers command";
+        case DUNGEONSCALE_RESCALE_TRIGGER_CONFIG_RELOAD:        return "Config reload";
+        case DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_LEVEL:         return "Player level change";
+        case DUNGEONSCALE_RESCALE_TRIGGER_MAP_LEVEL:            return "Map level shift";
+        case DUNGEONSCALE_RESCALE_TRIGGER_COMBAT_LOCK_LIFTED:   return "Combat lock lifted";
+        case DUNGEONSCALE_RESCALE_TRIGGER_ENABLED_STATE:        return "Enabled state change";
+        case DUNGEONSCALE_RESCALE_TRIGGER_MAP_CREATED:          return "Map created";
+        default:                                                return "Map update";
+    }
+}
+
+uint64 GetSteadyTimeMS()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// remember why the map is about to be reconfigured, the first reason since the last wave wins
+void SetRescaleTrigger(DungeonScaleMapInfo* mapDSInfo, DungeonScaleRescaleTrigger trigger)
+{
+    if (!mapDSInfo->pendingRescaleTrigger)
+        mapDSInfo->pendingRescaleTrigger = trigger;
+}
+
+// a wave's span runs from the reconfiguration to its last creature rescale, so it is written once the wave is over
+void TraceRescaleWave(Map* map, DungeonScaleMapInfo* mapDSInfo)
+{
+    if (!traceEnabled.load(std::memory_order_relaxed) || !mapDSInfo->rescaleHistoryCount)
+        return;
+
+    DungeonScaleRescaleWave const& wave = mapDSInfo->rescaleHistory[(mapDSInfo->rescaleHistoryNext + DUNGEONSCALE_RESCALE_HISTORY_SIZE - 1) % DUNGEONSCALE_RESCALE_HISTORY_SIZE];
+    if (!wave.creaturesReset)
+        return;
+
+    WriteTraceSpan("RescaleWave", wave.startTime * 1000, (wave.lastRescaleTime - wave.startTime) * 1000, map->GetId(), map->GetInstanceId(),
+        std::string("\"trigger\":\"") + GetRescaleTriggerName(wave.trigger) + "\"" +
+        ",\"players\":" + std::to_string(wave.adjustedPlayerCount) +
+        ",\"level\":" + std::to_string(wave.mapLevel) +
+        ",\"reset\":" + std::to_string(wave.creaturesReset) +
+        ",\"restored\":" + std::to_string(wave.creaturesRestored) +
+        ",\"deferred\":" + std::to_string(wave.creaturesDeferred) +
+        ",\"ticks\":" + std::to_string(wave.ticks) +
+        ",\"rescaleUs\":" + std::to_string(wave.rescaleTimeNs / 1000)
+    );
+}
+
+// the map config time moved on, so all of the map's creatures are out of date: record a new wave
+void StartRescaleWave(Map* map, DungeonScaleMapInfo* mapDSInfo)
+{
+    TraceRescaleWave(map, mapDSInfo);
+
+    DungeonScaleRescaleWave& wave = mapDSInfo->rescaleHistory[mapDSInfo->rescaleHistoryNext];
+    wave = DungeonScaleRescaleWave();
+    wave.startTime = GetSteadyTimeMS();
+    wave.trigger = mapDSInfo->pendingRescaleTrigger;
+    wave.adjustedPlayerCount = mapDSInfo->adjustedPlayerCount;
+    wave.mapLevel = mapDSInfo->mapLevel;
+
+    mapDSInfo->pendingRescaleTrigger = DUNGEONSCALE_RESCALE_TRIGGER_NONE;
+    mapDSInfo->rescaleHistoryNext = (mapDSInfo->rescaleHistoryNext + 1) % DUNGEONSCALE_RESCALE_HISTORY_SIZE;
+
+    if (mapDSInfo->rescaleHistoryCount < DUNGEONSCALE_RESCALE_HISTORY_SIZE)
+        mapDSInfo->rescaleHistoryCount++;
+
+    if (mapDSInfo->recorder)
+    {
+        DungeonScaleRecord& record = mapDSInfo->recorder->Append(DUNGEONSCALE_RECORD_MAP_RESCALE, 0, wave.startTime);
+        record.flags = (wave.trigger == DUNGEONSCALE_RESCALE_TRIGGER_CONFIG_RELOAD ? DUNGEONSCALE_RECORD_FLAG_CONFIG_RELOADED : 0) |
+                       (mapDSInfo->worldMultiplierPlayerCount ? DUNGEONSCALE_RECORD_FLAG_WORLD_SCALED : 0);
+        record.playerCount = mapDSInfo->adjustedPlayerCount;
+        record.detail = wave.trigger;
+        record.values[0] = mapDSInfo->worldHealthMultiplier;
+        record.values[1] = mapDSInfo->worldDamageHealingMultiplier;
+        record.values[2] = mapDSInfo->mapLevel;
+    }
+
+    DUNGEONSCALE_PROBE6(map__reconfigure,
+        map->GetId(),
+        map->GetInstanceId(),
+        mapDSInfo->adjustedPlayerCount,
+        wave.trigger,
+        GetProbeMultiplier(mapDSInfo->worldHealthMultiplier),
+        GetProbeMultiplier(mapDSInfo->worldDamageHealingMultiplier)
+    );
+}
+
+// the most recent wave (the one creatures are currently being rescaled for), nullptr if there wasn't one yet
+DungeonScaleRescaleWave* GetCurrentRescaleWave(DungeonScaleMapInfo* mapDSInfo)
+{
+    if (!mapDSInfo->rescaleHistoryCount)
+        return nullptr;
+
+    return &mapDSInfo->rescaleHistory[(mapDSInfo->rescaleHistoryNext + DUNGEONSCALE_RESCALE_HISTORY_SIZE - 1) % DUNGEONSCALE_RESCALE_HISTORY_SIZE];
+}
+
+void RecordCreatureRescale(DungeonScaleMapInfo* mapDSInfo, bool restoredToBaseStats, uint64 rescaleTimeNs)
+{
+    DungeonScaleRescaleWave* wave = GetCurrentRescaleWave(mapDSInfo);
+    if (!wave)
+        return;
+
+    wave->creaturesReset++;
+    wave->creaturesRestored += restoredToBaseStats;
+    wave->rescaleTimeNs += rescaleTimeNs;
+    wave->lastRescaleTime = GetSteadyTimeMS();
+
+    // all of a map's creatures are updated within the same world tick, so the game time identifies the tick
+    uint64 tickTime = GameTime::GetGameTimeMS().count();
+    if (wave->lastTickTime != tickTime)
+    {
+        wave->lastTickTime = tickTime;
+        wave->ticks++;
+    }
+}
+
+void RecordDamageHealing(Unit* source, DungeonScaleMapInfo* mapDSInfo, DungeonScaleDamageHealingEvent const& event, DungeonScaleDamageHealingBranch branch, float multiplier, int32 result)
+{
+    DUNGEONSCALE_PROBE7(damage__modify, source->GetMapId(), source->GetEntry(), event.spellId, branch, event.amount, GetProbeMultiplier(multiplier), result);
+
+    if (!mapDSInfo->recorder)
+        return;
+
+    DungeonScaleRecord& record = mapDSInfo->recorder->Append(DUNGEONSCALE_RECORD_DAMAGE_HEALING, event.spellId, GetSteadyTimeMS());
+    record.flags = PackDamageHealingEventFlags(event);
+    record.playerCount = mapDSInfo->adjustedPlayerCount;
+    record.detail = branch;
+    record.values[0] = event.amount;
+    record.values[1] = multiplier;
+    record.values[2] = result;
+}
+
+// creatures with out-of-date scaling are rescaled in order of how soon they matter:
+// in combat right away, then close creatures and then the rest within a player's visibility or activation range,
+// up to `DungeonScale.Rescale.MaxPerTick` per map update, and everything else is deferred until a player comes within that range
+bool IsCreatureRescaleDue(Creature* creature, DungeonScaleCreatureInfo* creatureDSInfo, DungeonScaleMapInfo* mapDSInfo)
+{
+    if (creature->IsInCombat())
+        return true;
+
+    // nothing to order or defer
+    if (!RescaleDeferDistant && !RescaleMaxPerTick)
+        return true;
+
+    // all of a map's creatures are updated within the same world tick, so the game time identifies the tick
+    uint64 tickTime = GameTime::GetGameTimeMS().count();
+    if (mapDSInfo->rescaleTickTime != tickTime)
+    {
+        mapDSInfo->rescaleTickTime = tickTime;
+        mapDSInfo->rescalesThisTick = 0;
+        mapDSInfo->closeRescalesWaiting = mapDSInfo->closeRescalesRefused;
+        mapDSInfo->closeRescalesRefused = 0;
+
+        // the bounds are collected once per tick for all of the map's out-of-date creatures, an approximation:
+        // players update inside the same map update as the creatures, so by the time a creature is checked they can be a tick stale
+        CollectNearPlayerBounds(creature->GetMap(), mapDSInfo);
+    }
+
+    DungeonScalePlayerProximity proximity = GetCreaturePlayerProximity(creature, mapDSInfo);
+
+    if (RescaleDeferDistant && !proximity)
+    {
+        // count each creature once per deferral, not once per update
+        if (!creatureDSInfo->isRescaleDeferred)
+        {
+            creatureDSInfo->isRescaleDeferred = true;
+            mapDSInfo->rescalesDeferred++;
+
+            if (DungeonScaleRescaleWave* wave = GetCurrentRescaleWave(mapDSInfo))
+                wave->creaturesDeferred++;
+        }
+
+        return false;
+    }
+
+    // 0 means no limit
+    if (!RescaleMaxPerTick)
+        return true;
+
+    if (mapDSInfo->rescalesThisTick >= RescaleMaxPerTick)
+    {
+        if (proximity == DUNGEONSCALE_PROXIMITY_CLOSE)
+            mapDSInfo->closeRescalesRefused++;
+
+        return false;
+    }
+
+    // close creatures go first, the ones farther out wait until none of those were left over last tick
+    if (proximity != DUNGEONSCALE_PROXIMITY_CLOSE && mapDSInfo->closeRescalesWaiting)
+        return false;
+
+    mapDSInfo->rescalesThisTick++;
+    return true;
+}
+
+// whether or not the creature's DS info was released because it isn't relevant
+bool isCreatureInfoReleased(Creature* creature)
+{
+    DungeonScaleMapInfo *mapDSInfo=creature->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+
+    return !mapDSInfo->notRelevantCreatures.empty() && mapDSInfo->notRelevantCreatures.count(creature->GetGUID());
+}
+
+// drop the full record of a creature that isn't relevant, the map remembers the verdict instead
+void ReleaseCreatureInfoIfNotRelevant(Creature* creature)
+{
+    DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.Get<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+
+    // only creatures with a final "not relevant" verdict that aren't tracked by the map can be released
+    if (!creatureDSInfo || creatureDSInfo->relevance != DUNGEONSCALE_RELEVANCE_FALSE || creatureDSInfo->isInCreatureList)
+    {
+        return;
+    }
+
+    DungeonScaleMapInfo *mapDSInfo=creature->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+    mapDSInfo->notRelevantCreatures.insert(creature->GetGUID());
+    creature->CustomData.Erase("DungeonScaleCreatureInfo");
+
+    LOG_DEBUG("module.DungeonScale", "DungeonScale::ReleaseCreatureInfoIfNotRelevant: Creature {} ({}) | is not relevant, its info was released.",
+                creature->GetName(),
+                creature->GetLevel()
+    );
+}
+
 bool isCreatureRelevant(Creature* creature) {
     // if the creature is gone, return false
     if (!creature)
@@ -848,9 +1138,18 @@ bool isCreatureRelevant(Creature* creature) {
         return false;
     }
 
-    // get the creature's info
-    DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
-
+    // get the creature's info, creatures without any have either been released as not relevant or are new
+    DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.Get<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+    if (!creatureDSInfo)
+    {
+        if (isCreatureInfoReleased(creature))
+        {
+            return false;
+        }
+
+        creatureDSInfo = creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+    }
+
     // if this creature has been already been evaluated, just return the previous evaluation
     if (creatureDSInfo->relevance == DUNGEONSCALE_RELEVANCE_FALSE)
     {
@@ -986,7 +1285,7 @@ bool isCreatureRelevant(Creature* creature) {
 
     // if this is a flavor critter
     // level and health checks for some nasty level 1 critters in some encounters
-    if ((creature->IsCritter() && creatureDSInfo->UnmodifiedLevel <= 5 && creature->GetMaxHealth() < 100))
+    if ((GetCreatureTemplateInfo(creature).isCritter && creatureDSInfo->UnmodifiedLevel <= 5 && creature->GetMaxHealth() < 100))
     {
         creatureDSInfo->relevance = DUNGEONSCALE_RELEVANCE_FALSE;
         LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::isCreatureRelevant: Creature {} ({}) | is a non-relevant critter, no changes. Marked for skip.",
@@ -1007,189 +1306,106 @@ bool isCreatureRelevant(Creature* creature) {
 
 }
 
-DungeonScaleInflectionPointSettings getInflectionPointSettings (InstanceMap* instanceMap, bool isBoss = false)
+// describe the instance map to the scaling engine
+DungeonScaleMapDescriptor GetMapDescriptor(Map* map)
 {
-    uint32 maxNumberOfPlayers = instanceMap->GetMaxPlayers();
-    uint32 mapId = instanceMap->GetEntry()->MapID;
+    DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
 
-    float inflectionValue, curveFloor, curveCeiling;
+    DungeonScaleMapDescriptor mapDescriptor;
+    mapDescriptor.mapId = map->GetId();
+    mapDescriptor.maxPlayers = map->ToInstanceMap()->GetMaxPlayers();
+    mapDescriptor.isHeroic = map->IsHeroic();
+    mapDescriptor.adjustedPlayerCount = mapDSInfo->adjustedPlayerCount;
 
-    inflectionValue  = (float)maxNumberOfPlayers;
+    return mapDescriptor;
+}
+
+// move the map's contribution to the server-wide metrics gauges to its current state, or take all of it back out
+void PublishMapMetrics(Map* map, DungeonScaleMapInfo* mapDSInfo, bool retract = false)
+{
+    uint32 trackedCreatures = retract ? 0 : mapDSInfo->allMapCreatures.size();
+    uint32 activeCreatures = retract ? 0 : mapDSInfo->activeCreatureCount;
+    bool combatLocked = !retract && mapDSInfo->combatLocked;
+    int8 instanceType = -1;
 
-    //
-    // Base Inflection Point
-    //
-    if (instanceMap->IsHeroic())
+    if (!retract && mapDSInfo->enabled)
     {
-        if (maxNumberOfPlayers <= 5)
-        {
-            inflectionValue *= InflectionPointHeroic;
-            curveFloor = InflectionPointHeroicCurveFloor;
-            curveCeiling = InflectionPointHeroicCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            inflectionValue *= InflectionPointRaid10MHeroic;
-            curveFloor = InflectionPointRaid10MHeroicCurveFloor;
-            curveCeiling = InflectionPointRaid10MHeroicCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            inflectionValue *= InflectionPointRaid25MHeroic;
-            curveFloor = InflectionPointRaid25MHeroicCurveFloor;
-            curveCeiling = InflectionPointRaid25MHeroicCurveCeiling;
-        }
-        else
-        {
-            inflectionValue *= InflectionPointRaidHeroic;
-            curveFloor = InflectionPointRaidHeroicCurveFloor;
-            curveCeiling = InflectionPointRaidHeroicCurveCeiling;
-        }
+        DungeonScaleMapDescriptor mapDescriptor = GetMapDescriptor(map);
+        instanceType = GetInstanceType(mapDescriptor.maxPlayers, mapDescriptor.isHeroic);
     }
-    else
+
+    if (trackedCreatures != mapDSInfo->publishedTrackedCreatures)
     {
-        if (maxNumberOfPlayers <= 5)
-        {
-            inflectionValue *= InflectionPoint;
-            curveFloor = InflectionPointCurveFloor;
-            curveCeiling = InflectionPointCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            inflectionValue *= InflectionPointRaid10M;
-            curveFloor = InflectionPointRaid10MCurveFloor;
-            curveCeiling = InflectionPointRaid10MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 15)
-        {
-            inflectionValue *= InflectionPointRaid15M;
-            curveFloor = InflectionPointRaid15MCurveFloor;
-            curveCeiling = InflectionPointRaid15MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 20)
-        {
-            inflectionValue *= InflectionPointRaid20M;
-            curveFloor = InflectionPointRaid20MCurveFloor;
-            curveCeiling = InflectionPointRaid20MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            inflectionValue *= InflectionPointRaid25M;
-            curveFloor = InflectionPointRaid25MCurveFloor;
-            curveCeiling = InflectionPointRaid25MCurveCeiling;
-        }
-        else if (maxNumberOfPlayers <= 40)
-        {
-            inflectionValue *= InflectionPointRaid40M;
-            curveFloor = InflectionPointRaid40MCurveFloor;
-            curveCeiling = InflectionPointRaid40MCurveCeiling;
-        }
-        else
-        {
-            inflectionValue *= InflectionPointRaid;
-            curveFloor = InflectionPointRaidCurveFloor;
-            curveCeiling = InflectionPointRaidCurveCeiling;
-        }
+        AddPerfGauge(DUNGEONSCALE_PERF_GAUGE_TRACKED_CREATURES, int64(trackedCreatures) - mapDSInfo->publishedTrackedCreatures);
+        mapDSInfo->publishedTrackedCreatures = trackedCreatures;
     }
 
-    // Per map ID overrides alter the above settings, if set
-    if (hasDungeonOverride(mapId))
+    if (activeCreatures != mapDSInfo->publishedActiveCreatures)
     {
-        DungeonScaleInflectionPointSettings* myInflectionPointOverrides = &dungeonOverrides[mapId];
-
-        // Alter the inflectionValue according to the override, if set
-        if (myInflectionPointOverrides->value != -1)
-        {
-            inflectionValue  = (float)maxNumberOfPlayers; // Starting over
-            inflectionValue *= myInflectionPointOverrides->value;
-        }
+        AddPerfGauge(DUNGEONSCALE_PERF_GAUGE_ACTIVE_CREATURES, int64(activeCreatures) - mapDSInfo->publishedActiveCreatures);
+        mapDSInfo->publishedActiveCreatures = activeCreatures;
+    }
 
-        if (myInflectionPointOverrides->curveFloor != -1)   { curveFloor =    myInflectionPointOverrides->curveFloor;   }
-        if (myInflectionPointOverrides->curveCeiling != -1) { curveCeiling =  myInflectionPointOverrides->curveCeiling; }
+    if (combatLocked != mapDSInfo->publishedCombatLocked)
+    {
+        AddPerfGauge(DUNGEONSCALE_PERF_GAUGE_COMBAT_LOCKED_MAPS, combatLocked ? 1 : -1);
+        mapDSInfo->publishedCombatLocked = combatLocked;
     }
 
-    //
-    // Boss Inflection Point
-    //
-    if (isBoss) {
+    if (instanceType != mapDSInfo->publishedInstanceType)
+    {
+        if (mapDSInfo->publishedInstanceType >= 0)
+            AddPerfGauge(DungeonScalePerfGauge(DUNGEONSCALE_PERF_GAUGE_ENABLED_INSTANCES + mapDSInfo->publishedInstanceType), -1);
 
-        float bossInflectionPointMultiplier;
+        if (instanceType >= 0)
+            AddPerfGauge(DungeonScalePerfGauge(DUNGEONSCALE_PERF_GAUGE_ENABLED_INSTANCES + instanceType), 1);
 
-        if (instanceMap->IsHeroic())
-        {
-            if (maxNumberOfPlayers <= 5)
-            {
-                bossInflectionPointMultiplier = InflectionPointHeroicBoss;
-            }
-            else if (maxNumberOfPlayers <= 10)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid10MHeroicBoss;
-            }
-            else if (maxNumberOfPlayers <= 25)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid25MHeroicBoss;
-            }
-            else
-            {
-                bossInflectionPointMultiplier = InflectionPointRaidHeroicBoss;
-            }
-        }
+        mapDSInfo->publishedInstanceType = instanceType;
+    }
+
+    bool isPublished = trackedCreatures || activeCreatures || combatLocked || instanceType >= 0;
+    if (isPublished != mapDSInfo->isMetricsPublished)
+    {
+        if (isPublished)
+            MetricsPublishedMaps.fetch_add(1, std::memory_order_relaxed);
         else
-        {
-            if (maxNumberOfPlayers <= 5)
-            {
-                bossInflectionPointMultiplier = InflectionPointBoss;
-            }
-            else if (maxNumberOfPlayers <= 10)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid10MBoss;
-            }
-            else if (maxNumberOfPlayers <= 15)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid15MBoss;
-            }
-            else if (maxNumberOfPlayers <= 20)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid20MBoss;
-            }
-            else if (maxNumberOfPlayers <= 25)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid25MBoss;
-            }
-            else if (maxNumberOfPlayers <= 40)
-            {
-                bossInflectionPointMultiplier = InflectionPointRaid40MBoss;
-            }
-            else
-            {
-                bossInflectionPointMultiplier = InflectionPointRaidBoss;
-            }
-        }
+            MetricsPublishedMaps.fetch_sub(1, std::memory_order_relaxed);
 
-        // Per map ID overrides alter the above settings, if set
-        if (hasBossOverride(mapId))
-        {
-            DungeonScaleInflectionPointSettings* myBossOverrides = &bossOverrides[mapId];
+        mapDSInfo->isMetricsPublished = isPublished;
+    }
+}
 
-            // If set, alter the inflectionValue according to the override
-            if (myBossOverrides->value != -1)
-            {
-                inflectionValue *= myBossOverrides->value;
-            }
-            // Otherwise, calculate using the value determined by instance type
-            else
-            {
-                inflectionValue *= bossInflectionPointMultiplier;
-            }
-        }
-        // No override, use the value determined by the instance type
-        else
-        {
-            inflectionValue *= bossInflectionPointMultiplier;
-        }
+// write the instance's recording with the config that currently applies to it, returns the file name or an empty string
+std::string SaveMapRecording(Map* map, DungeonScaleMapInfo* mapDSInfo)
+{
+    if (!mapDSInfo->recorder)
+        return "";
+
+    DungeonScaleRecordingHeader header;
+    SetRecordingConfig(header, engineConfig, GetMapDescriptor(map));
+    header.instanceId = map->GetInstanceId();
+
+    std::string path = RecorderDirectory.empty() ? "" : RecorderDirectory + "/";
+    path += "dungeonscale-" + std::to_string(map->GetId()) + "-" + std::to_string(map->GetInstanceId()) + "-" + std::to_string(GameTime::GetGameTime().count()) +
+        "-" + std::to_string(++mapDSInfo->recordingSaves) + ".dsrec";
+
+    if (!mapDSInfo->recorder->Save(path, header))
+    {
+        LOG_ERROR("module.DungeonScale", "DungeonScale::SaveMapRecording: Map {} ({}-{}) | Could not write the recording to {}.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId(),
+            path
+        );
+        return "";
     }
 
-    return DungeonScaleInflectionPointSettings(inflectionValue, curveFloor, curveCeiling);
+    return path;
+}
+
+DungeonScaleInflectionPointSettings getInflectionPointSettings (InstanceMap* instanceMap, bool isBoss = false)
+{
+    return CalculateInflectionPointSettings(engineConfig, GetMapDescriptor(instanceMap), isBoss);
 }
 
 void getStatModifiersDebug(Map *map, Creature *creature, std::string message)
@@ -1222,354 +1438,27 @@ void getStatModifiersDebug(Map *map, Creature *creature, std::string message)
     }
 }
 
-DungeonScaleStatModifiers getStatModifiers (Map* map, Creature* creature = nullptr)
+DungeonScaleStatModifiers getStatModifiers (Map* map, Creature* creature = nullptr, bool isBoss = false)
 {
-    // get the instance's InstanceMap
-    InstanceMap* instanceMap = map->ToInstanceMap();
-
-    // map variables
-    uint32 maxNumberOfPlayers = instanceMap->GetMaxPlayers();
-    uint32 mapId = map->GetId();
+    DungeonScaleMapDescriptor mapDescriptor = GetMapDescriptor(map);
 
     // get the creature's info if a creature was specified
     DungeonScaleCreatureInfo* creatureDSInfo = nullptr;
+    DungeonScaleCreatureDescriptor creatureDescriptor;
     if (creature)
     {
         creatureDSInfo = creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
-    }
-
-    // this will be the return value
-    DungeonScaleStatModifiers statModifiers;
-
-    // Apply the per-instance-type modifiers first
-    // DungeonScale.StatModifier*(.Boss).<stat>
-    if (instanceMap->IsHeroic()) // heroic
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierHeroic_Boss_Global;
-                statModifiers.health = StatModifierHeroic_Boss_Health;
-                statModifiers.mana = StatModifierHeroic_Boss_Mana;
-                statModifiers.armor = StatModifierHeroic_Boss_Armor;
-                statModifiers.damage = StatModifierHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierHeroic_Global;
-                statModifiers.health = StatModifierHeroic_Health;
-                statModifiers.mana = StatModifierHeroic_Mana;
-                statModifiers.armor = StatModifierHeroic_Armor;
-                statModifiers.damage = StatModifierHeroic_Damage;
-                statModifiers.ccduration = StatModifierHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Heroic");
-            }
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid10MHeroic_Boss_Global;
-                statModifiers.health = StatModifierRaid10MHeroic_Boss_Health;
-                statModifiers.mana = StatModifierRaid10MHeroic_Boss_Mana;
-                statModifiers.armor = StatModifierRaid10MHeroic_Boss_Armor;
-                statModifiers.damage = StatModifierRaid10MHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid10MHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid10MHeroic_Global;
-                statModifiers.health = StatModifierRaid10MHeroic_Health;
-                statModifiers.mana = StatModifierRaid10MHeroic_Mana;
-                statModifiers.armor = StatModifierRaid10MHeroic_Armor;
-                statModifiers.damage = StatModifierRaid10MHeroic_Damage;
-                statModifiers.ccduration = StatModifierRaid10MHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Heroic");
-            }
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid25MHeroic_Boss_Global;
-                statModifiers.health = StatModifierRaid25MHeroic_Boss_Health;
-                statModifiers.mana = StatModifierRaid25MHeroic_Boss_Mana;
-                statModifiers.armor = StatModifierRaid25MHeroic_Boss_Armor;
-                statModifiers.damage = StatModifierRaid25MHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid25MHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid25MHeroic_Global;
-                statModifiers.health = StatModifierRaid25MHeroic_Health;
-                statModifiers.mana = StatModifierRaid25MHeroic_Mana;
-                statModifiers.armor = StatModifierRaid25MHeroic_Armor;
-                statModifiers.damage = StatModifierRaid25MHeroic_Damage;
-                statModifiers.ccduration = StatModifierRaid25MHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Heroic");
-            }
-        }
-        else
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaidHeroic_Boss_Global;
-                statModifiers.health = StatModifierRaidHeroic_Boss_Health;
-                statModifiers.mana = StatModifierRaidHeroic_Boss_Mana;
-                statModifiers.armor = StatModifierRaidHeroic_Boss_Armor;
-                statModifiers.damage = StatModifierRaidHeroic_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaidHeroic_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Heroic Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaidHeroic_Global;
-                statModifiers.health = StatModifierRaidHeroic_Health;
-                statModifiers.mana = StatModifierRaidHeroic_Mana;
-                statModifiers.armor = StatModifierRaidHeroic_Armor;
-                statModifiers.damage = StatModifierRaidHeroic_Damage;
-                statModifiers.ccduration = StatModifierRaidHeroic_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Heroic");
-            }
-        }
-    }
-    else // non-heroic
-    {
-        if (maxNumberOfPlayers <= 5)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifier_Boss_Global;
-                statModifiers.health = StatModifier_Boss_Health;
-                statModifiers.mana = StatModifier_Boss_Mana;
-                statModifiers.armor = StatModifier_Boss_Armor;
-                statModifiers.damage = StatModifier_Boss_Damage;
-                statModifiers.ccduration = StatModifier_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifier_Global;
-                statModifiers.health = StatModifier_Health;
-                statModifiers.mana = StatModifier_Mana;
-                statModifiers.armor = StatModifier_Armor;
-                statModifiers.damage = StatModifier_Damage;
-                statModifiers.ccduration = StatModifier_CCDuration;
-
-                getStatModifiersDebug(map, creature, "1 to 5 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 10)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid10M_Boss_Global;
-                statModifiers.health = StatModifierRaid10M_Boss_Health;
-                statModifiers.mana = StatModifierRaid10M_Boss_Mana;
-                statModifiers.armor = StatModifierRaid10M_Boss_Armor;
-                statModifiers.damage = StatModifierRaid10M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid10M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid10M_Global;
-                statModifiers.health = StatModifierRaid10M_Health;
-                statModifiers.mana = StatModifierRaid10M_Mana;
-                statModifiers.armor = StatModifierRaid10M_Armor;
-                statModifiers.damage = StatModifierRaid10M_Damage;
-                statModifiers.ccduration = StatModifierRaid10M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "10 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 15)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid15M_Boss_Global;
-                statModifiers.health = StatModifierRaid15M_Boss_Health;
-                statModifiers.mana = StatModifierRaid15M_Boss_Mana;
-                statModifiers.armor = StatModifierRaid15M_Boss_Armor;
-                statModifiers.damage = StatModifierRaid15M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid15M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "15 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid15M_Global;
-                statModifiers.health = StatModifierRaid15M_Health;
-                statModifiers.mana = StatModifierRaid15M_Mana;
-                statModifiers.armor = StatModifierRaid15M_Armor;
-                statModifiers.damage = StatModifierRaid15M_Damage;
-                statModifiers.ccduration = StatModifierRaid15M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "15 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 20)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid20M_Boss_Global;
-                statModifiers.health = StatModifierRaid20M_Boss_Health;
-                statModifiers.mana = StatModifierRaid20M_Boss_Mana;
-                statModifiers.armor = StatModifierRaid20M_Boss_Armor;
-                statModifiers.damage = StatModifierRaid20M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid20M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "20 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid20M_Global;
-                statModifiers.health = StatModifierRaid20M_Health;
-                statModifiers.mana = StatModifierRaid20M_Mana;
-                statModifiers.armor = StatModifierRaid20M_Armor;
-                statModifiers.damage = StatModifierRaid20M_Damage;
-                statModifiers.ccduration = StatModifierRaid20M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "20 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 25)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid25M_Boss_Global;
-                statModifiers.health = StatModifierRaid25M_Boss_Health;
-                statModifiers.mana = StatModifierRaid25M_Boss_Mana;
-                statModifiers.armor = StatModifierRaid25M_Boss_Armor;
-                statModifiers.damage = StatModifierRaid25M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid25M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid25M_Global;
-                statModifiers.health = StatModifierRaid25M_Health;
-                statModifiers.mana = StatModifierRaid25M_Mana;
-                statModifiers.armor = StatModifierRaid25M_Armor;
-                statModifiers.damage = StatModifierRaid25M_Damage;
-                statModifiers.ccduration = StatModifierRaid25M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "25 Player Normal");
-            }
-        }
-        else if (maxNumberOfPlayers <= 40)
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid40M_Boss_Global;
-                statModifiers.health = StatModifierRaid40M_Boss_Health;
-                statModifiers.mana = StatModifierRaid40M_Boss_Mana;
-                statModifiers.armor = StatModifierRaid40M_Boss_Armor;
-                statModifiers.damage = StatModifierRaid40M_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid40M_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "40 Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid40M_Global;
-                statModifiers.health = StatModifierRaid40M_Health;
-                statModifiers.mana = StatModifierRaid40M_Mana;
-                statModifiers.armor = StatModifierRaid40M_Armor;
-                statModifiers.damage = StatModifierRaid40M_Damage;
-                statModifiers.ccduration = StatModifierRaid40M_CCDuration;
-
-                getStatModifiersDebug(map, creature, "40 Player Normal");
-            }
-        }
-        else
-        {
-            if (creature && isBossOrBossSummon(creature))
-            {
-                statModifiers.global = StatModifierRaid_Boss_Global;
-                statModifiers.health = StatModifierRaid_Boss_Health;
-                statModifiers.mana = StatModifierRaid_Boss_Mana;
-                statModifiers.armor = StatModifierRaid_Boss_Armor;
-                statModifiers.damage = StatModifierRaid_Boss_Damage;
-                statModifiers.ccduration = StatModifierRaid_Boss_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Normal Boss");
-            }
-            else
-            {
-                statModifiers.global = StatModifierRaid_Global;
-                statModifiers.health = StatModifierRaid_Health;
-                statModifiers.mana = StatModifierRaid_Mana;
-                statModifiers.armor = StatModifierRaid_Armor;
-                statModifiers.damage = StatModifierRaid_Damage;
-                statModifiers.ccduration = StatModifierRaid_CCDuration;
-
-                getStatModifiersDebug(map, creature, "?? Player Normal");
-            }
-        }
-    }
 
-    // Per-Map Overrides
-    // DungeonScale.StatModifier.Boss.PerInstance
-    if (creature && isBossOrBossSummon(creature) && hasStatModifierBossOverride(mapId))
-    {
-        DungeonScaleStatModifiers* myStatModifierBossOverrides = &statModifierBossOverrides[mapId];
-
-        if (myStatModifierBossOverrides->global != -1)      { statModifiers.global =      myStatModifierBossOverrides->global;      }
-        if (myStatModifierBossOverrides->health != -1)      { statModifiers.health =      myStatModifierBossOverrides->health;      }
-        if (myStatModifierBossOverrides->mana != -1)        { statModifiers.mana =        myStatModifierBossOverrides->mana;        }
-        if (myStatModifierBossOverrides->armor != -1)       { statModifiers.armor =       myStatModifierBossOverrides->armor;       }
-        if (myStatModifierBossOverrides->damage != -1)      { statModifiers.damage =      myStatModifierBossOverrides->damage;      }
-        if (myStatModifierBossOverrides->ccduration != -1)  { statModifiers.ccduration =  myStatModifierBossOverrides->ccduration;  }
-
-        getStatModifiersDebug(map, creature, "Boss Per-Instance Override");
-    }
-    // DungeonScale.StatModifier.PerInstance
-    else if (hasStatModifierOverride(mapId))
-    {
-        DungeonScaleStatModifiers* myStatModifierOverrides = &statModifierOverrides[mapId];
-
-        if (myStatModifierOverrides->global != -1)      { statModifiers.global =      myStatModifierOverrides->global;      }
-        if (myStatModifierOverrides->health != -1)      { statModifiers.health =      myStatModifierOverrides->health;      }
-        if (myStatModifierOverrides->mana != -1)        { statModifiers.mana =        myStatModifierOverrides->mana;        }
-        if (myStatModifierOverrides->armor != -1)       { statModifiers.armor =       myStatModifierOverrides->armor;       }
-        if (myStatModifierOverrides->damage != -1)      { statModifiers.damage =      myStatModifierOverrides->damage;      }
-        if (myStatModifierOverrides->ccduration != -1)  { statModifiers.ccduration =  myStatModifierOverrides->ccduration;  }
-
-        getStatModifiersDebug(map, creature, "Per-Instance Override");
+        creatureDescriptor.entry = creature->GetEntry();
+        creatureDescriptor.isBoss = isBoss;
+        creatureDescriptor.creatureOverride = GetCreatureTemplateInfo(creature).creatureOverride;
     }
 
-    // Per-creature modifiers applied last
-    // DungeonScale.StatModifier.PerCreature
-    if (creature && hasStatModifierCreatureOverride(creature->GetEntry()))
-    {
-        DungeonScaleStatModifiers* myCreatureOverrides = &statModifierCreatureOverrides[creature->GetEntry()];
-
-        if (myCreatureOverrides->global != -1)      { statModifiers.global =      myCreatureOverrides->global;      }
-        if (myCreatureOverrides->health != -1)      { statModifiers.health =      myCreatureOverrides->health;      }
-        if (myCreatureOverrides->mana != -1)        { statModifiers.mana =        myCreatureOverrides->mana;        }
-        if (myCreatureOverrides->armor != -1)       { statModifiers.armor =       myCreatureOverrides->armor;       }
-        if (myCreatureOverrides->damage != -1)      { statModifiers.damage =      myCreatureOverrides->damage;      }
-        if (myCreatureOverrides->ccduration != -1)  { statModifiers.ccduration =  myCreatureOverrides->ccduration;  }
+    DungeonScaleStatModifiers statModifiers = CalculateStatModifiers(engineConfig, mapDescriptor, creature ? &creatureDescriptor : nullptr);
 
-        getStatModifiersDebug(map, creature, "Per-Creature Override");
-    }
+    getStatModifiersDebug(map, creature, std::string(GetInstanceTypeName(GetInstanceType(mapDescriptor.maxPlayers, mapDescriptor.isHeroic))) +
+                                         (creature && isBoss ? " Boss" : "") +
+                                         (creatureDescriptor.creatureOverride ? " | Per-Creature Override" : ""));
 
     if (creature)
     {
@@ -1609,71 +1498,39 @@ DungeonScaleStatModifiers getStatModifiers (Map* map, Creature* creature = nullp
 
 float getDefaultMultiplier(Map* map, DungeonScaleInflectionPointSettings inflectionPointSettings)
 {
-    // You can visually see the effects of this function by using this spreadsheet:
-    // https://docs.google.com/spreadsheets/d/100cmKIJIjCZ-ncWd0K9ykO8KUgwFTcwg4h2nfE_UeCc/copy
-
-    // get the max player count for the map
-    uint32 maxNumberOfPlayers = map->ToInstanceMap()->GetMaxPlayers();
-
-    // get the adjustedPlayerCount for this instance
-    DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
-    float adjustedPlayerCount = mapDSInfo->adjustedPlayerCount;
-
-    // #maththings
-    float diff = ((float)maxNumberOfPlayers/5)*1.5f;
-
-    // For math reasons that I do not understand, curveCeiling needs to be adjusted to bring the actual multiplier
-    // closer to the curveCeiling setting. Create an adjustment based on how much the ceiling should be changed at
-    // the max players multiplier.
-    float curveCeilingAdjustment =
-        inflectionPointSettings.curveCeiling /
-        (((tanh(((float)maxNumberOfPlayers - inflectionPointSettings.value) / diff) + 1.0f) / 2.0f) *
-        (inflectionPointSettings.curveCeiling - inflectionPointSettings.curveFloor) + inflectionPointSettings.curveFloor);
-
-    // Adjust the multiplier based on the configured floor and ceiling values, plus the ceiling adjustment we just calculated
-    float defaultMultiplier =
-        ((tanh((adjustedPlayerCount - inflectionPointSettings.value) / diff) + 1.0f) / 2.0f) *
-        (inflectionPointSettings.curveCeiling * curveCeilingAdjustment - inflectionPointSettings.curveFloor) +
-        inflectionPointSettings.curveFloor;
-
-    return defaultMultiplier;
+    return CalculateDefaultMultiplier(GetMapDescriptor(map), inflectionPointSettings);
 }
 
-float getWorldMultiplier(Map* map, BaseValueType baseValueType)
+void UpdateWorldMultipliers(Map* map)
 {
-    float worldMultiplier = 1.0f;
-
     // null check
     if (!map)
     {
-        return worldMultiplier;
+        return;
     }
 
-    // if this isn't a dungeon, return defaults
+    // if this isn't a dungeon, there's nothing to store the multipliers on
     if (!(map->IsDungeon()))
     {
-        return worldMultiplier;
+        return;
     }
 
     // grab map data
     DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
 
-    // if the map isn't enabled, return defaults
-    if (!mapDSInfo->enabled)
+    // if the map isn't enabled, there are no players on the map or creatures haven't been counted yet, use defaults
+    if (!mapDSInfo->enabled || mapDSInfo->allMapPlayers.size() == 0 || mapDSInfo->avgCreatureLevel == 0)
     {
-        return worldMultiplier;
-    }
-
-    // if there are no players on the map, return defaults
-    if (mapDSInfo->allMapPlayers.size() == 0)
-    {
-        return worldMultiplier;
+        mapDSInfo->worldHealthMultiplier = 1.0f;
+        mapDSInfo->worldDamageHealingMultiplier = 1.0f;
+        mapDSInfo->worldMultiplierPlayerCount = 0;
+        return;
     }
 
-    // if creatures haven't been counted yet, return defaults
-    if (mapDSInfo->avgCreatureLevel == 0)
+    // the multipliers only depend on the adjusted player count and the config
+    if (mapDSInfo->worldMultiplierPlayerCount == mapDSInfo->adjustedPlayerCount && mapDSInfo->worldMultiplierConfigTime == globalConfigTime)
     {
-        return worldMultiplier;
+        return;
     }
 
     // create some data variables
@@ -1687,39 +1544,27 @@ float getWorldMultiplier(Map* map, BaseValueType baseValueType)
     // This value is only based on the adjusted number of players in the instance
     float defaultMultiplier = getDefaultMultiplier(map, inflectionPointSettings);
 
-    LOG_DEBUG("module.DungeonScale",
-        "DungeonScale::getWorldMultiplier: Map {} ({}) {} | defaultMultiplier ({}) = getDefaultMultiplier(map, inflectionPointSettings)",
-        map->GetMapName(),
-        avgCreatureLevelRounded,
-        baseValueType == BaseValueType::DUNGEONSCALE_HEALTH ? "health" : "damage",
-        defaultMultiplier
-    );
-
-    // multiply by the appropriate stat modifiers
+    // multiply by the appropriate stat modifiers, health and damage come from the same set
     DungeonScaleStatModifiers statModifiers = getStatModifiers(map);
 
-    if (baseValueType == BaseValueType::DUNGEONSCALE_HEALTH) // health
-    {
-        worldMultiplier = defaultMultiplier * statModifiers.global * statModifiers.health;
-    }
-    else // damage
-    {
-        worldMultiplier = defaultMultiplier * statModifiers.global * statModifiers.damage;
-    }
+    mapDSInfo->worldHealthMultiplier = defaultMultiplier * statModifiers.global * statModifiers.health;
+    mapDSInfo->worldDamageHealingMultiplier = defaultMultiplier * statModifiers.global * statModifiers.damage;
+
+    // remember the inputs
+    mapDSInfo->worldMultiplierPlayerCount = mapDSInfo->adjustedPlayerCount;
+    mapDSInfo->worldMultiplierConfigTime = globalConfigTime;
 
     LOG_DEBUG("module.DungeonScale",
-        "DungeonScale::getWorldMultiplier: Map {} ({}) {} | worldMultiplier ({}) = defaultMultiplier ({}) * statModifiers.global ({}) * statModifiers.{} ({})",
+        "DungeonScale::UpdateWorldMultipliers: Map {} ({}) | defaultMultiplier ({}) * statModifiers.global ({}) | health ({}) = ({}) | damage ({}) = ({})",
         map->GetMapName(),
         avgCreatureLevelRounded,
-        baseValueType == BaseValueType::DUNGEONSCALE_HEALTH ? "health" : "damage",
-        worldMultiplier,
         defaultMultiplier,
         statModifiers.global,
-        baseValueType == BaseValueType::DUNGEONSCALE_HEALTH ? "health" : "damage",
-        baseValueType == BaseValueType::DUNGEONSCALE_HEALTH ? statModifiers.health : statModifiers.damage
+        statModifiers.health,
+        mapDSInfo->worldHealthMultiplier,
+        statModifiers.damage,
+        mapDSInfo->worldDamageHealingMultiplier
     );
-
-    return worldMultiplier;
 }
 
 void LoadMapSettings(Map* map)
@@ -1789,6 +1634,10 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
     InstanceMap* instanceMap = map->ToInstanceMap();
     DungeonScaleMapInfo *mapDSInfo=instanceMap->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
     DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+    DungeonScaleCreatureTemplateInfo const& templateInfo = GetCreatureTemplateInfo(creature);
+
+    // resolve whether this is a boss or a boss summon once per add, the summoner may have changed since the last one
+    ResolveCreatureBossFlag(creature, creatureDSInfo);
 
     // handle summoned creatures
     if (creature->IsSummon())
@@ -1801,9 +1650,8 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
             creature->ToTempSummon()->GetSummoner() &&
             creature->ToTempSummon()->GetSummoner()->ToCreature())
         {
-            creatureDSInfo->summoner = creature->ToTempSummon()->GetSummoner()->ToCreature();
-            creatureDSInfo->summonerName = creatureDSInfo->summoner->GetName();
-            Creature* summoner = creatureDSInfo->summoner;
+            Creature* summoner = creature->ToTempSummon()->GetSummoner()->ToCreature();
+            creatureDSInfo->summonerGUID = summoner->GetGUID();
 
             if (!summoner)
             {
@@ -1815,17 +1663,19 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
             }
             else
             {
-                DungeonScaleCreatureInfo *summonerDSInfo=summoner->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+                // a summoner without its own info was never scaled, so its current level is its original level
+                DungeonScaleCreatureInfo const* summonerDSInfo = summoner->CustomData.Get<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+                uint8 summonerUnmodifiedLevel = summonerDSInfo ? summonerDSInfo->UnmodifiedLevel : summoner->GetLevel();
 
                 LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | is owned by {} ({}).",
                             creature->GetName(),
                             creatureDSInfo->UnmodifiedLevel,
                             summoner->GetName(),
-                            summonerDSInfo->UnmodifiedLevel
+                            summonerUnmodifiedLevel
                 );
 
                 // if the creature or its summoner is a trigger
-                if (creature->IsTrigger() || summoner->IsTrigger())
+                if (templateInfo.isTrigger || GetCreatureTemplateInfo(summoner).isTrigger)
                 {
                     LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | or their summoner is a trigger.",
                                 creature->GetName(),
@@ -1834,15 +1684,15 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
 
                     // if the creature is within the expected level range, allow scaling
                     if (
-                        (creatureDSInfo->UnmodifiedLevel >= (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f)) &&
-                        (creatureDSInfo->UnmodifiedLevel <= (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f))
+                        (creatureDSInfo->UnmodifiedLevel >= mapDSInfo->lfgMinLevelBound) &&
+                        (creatureDSInfo->UnmodifiedLevel <= mapDSInfo->lfgMaxLevelBound)
                     )
                     {
                         LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | original level is within the expected NPC level for this map ({} to {}). Level scaling is allowed.",
                                     creature->GetName(),
                                     creatureDSInfo->UnmodifiedLevel,
-                                    (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f),
-                                    (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f)
+                                    mapDSInfo->lfgMinLevelBound,
+                                    mapDSInfo->lfgMaxLevelBound
                         );
                     }
                     else {
@@ -1850,8 +1700,8 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
                         LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | original level is outside the expected NPC level for this map ({} to {}). It will keep its original level.",
                                     creature->GetName(),
                                     creatureDSInfo->UnmodifiedLevel,
-                                    (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f),
-                                    (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f)
+                                    mapDSInfo->lfgMinLevelBound,
+                                    mapDSInfo->lfgMaxLevelBound
                         );
                     }
                 }
@@ -1859,12 +1709,12 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
                 else
                 {
                     // match the summoner's level
-                    creatureDSInfo->UnmodifiedLevel = summonerDSInfo->UnmodifiedLevel;
+                    creatureDSInfo->UnmodifiedLevel = summonerUnmodifiedLevel;
 
                     LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | original level will match summoner's level ({}).",
                                 creature->GetName(),
                                 creatureDSInfo->UnmodifiedLevel,
-                                summonerDSInfo->UnmodifiedLevel
+                                summonerUnmodifiedLevel
                     );
                 }
             }
@@ -1929,22 +1779,22 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
         return;
     }
     // handle "special" creatures
-    else if (creature->IsCritter() || creature->IsTotem() || creature->IsTrigger())
+    else if (templateInfo.isCritter || creature->IsTotem() || templateInfo.isTrigger)
     {
         // if this is an intentionally-low-level creature (below 85% of the minimum LFG level), leave it where it is
         // if this is an intentionally-high-level creature (above 125% of the maximum LFG level), leave it where it is
         if (
-            (creatureDSInfo->UnmodifiedLevel < (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f)) ||
-            (creatureDSInfo->UnmodifiedLevel > (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f))
+            (creatureDSInfo->UnmodifiedLevel < mapDSInfo->lfgMinLevelBound) ||
+            (creatureDSInfo->UnmodifiedLevel > mapDSInfo->lfgMaxLevelBound)
         )
         {
             creatureDSInfo->neverLevelScale = true;
             LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | is a {} and is outside the expected NPC level for this map ({} to {}). Keeping original level of {}.",
                         creature->GetName(),
                         creatureDSInfo->UnmodifiedLevel,
-                        creature->IsCritter() ? "critter" : creature->IsTotem() ? "totem" : "trigger",
-                        (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f),
-                        (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f),
+                        templateInfo.isCritter ? "critter" : creature->IsTotem() ? "totem" : "trigger",
+                        mapDSInfo->lfgMinLevelBound,
+                        mapDSInfo->lfgMaxLevelBound,
                         creatureDSInfo->UnmodifiedLevel
             );
         }
@@ -1955,9 +1805,9 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
             LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) (summon) | is a {} and is within the expected NPC level for this map ({} to {}). Keeping original level of {}.",
                         creature->GetName(),
                         creatureDSInfo->UnmodifiedLevel,
-                        creature->IsCritter() ? "critter" : creature->IsTotem() ? "totem" : "trigger",
-                        (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f),
-                        (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f),
+                        templateInfo.isCritter ? "critter" : creature->IsTotem() ? "totem" : "trigger",
+                        mapDSInfo->lfgMinLevelBound,
+                        mapDSInfo->lfgMaxLevelBound,
                         creatureDSInfo->UnmodifiedLevel
             );
 
@@ -1983,25 +1833,25 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
     }
 
     // if this is a non-relevant creature, skip for stats
-    if (creature->IsCritter() || creature->IsTotem() || creature->IsTrigger())
+    if (templateInfo.isCritter || creature->IsTotem() || templateInfo.isTrigger)
     {
         LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) | is a {} and will not affect the map's stats.",
             creature->GetName(),
             creatureDSInfo->UnmodifiedLevel,
-            creature->IsCritter() ? "critter" : creature->IsTotem() ? "totem" : "trigger"
+            templateInfo.isCritter ? "critter" : creature->IsTotem() ? "totem" : "trigger"
         );
         return;
     }
 
     // if the creature level is below 85% of the minimum LFG level, assume it's a flavor creature and shouldn't be tracked
-    if (creatureDSInfo->UnmodifiedLevel < (uint8)(((float)mapDSInfo->lfgMinLevel * 0.85f) + 0.5f))
+    if (creatureDSInfo->UnmodifiedLevel < mapDSInfo->lfgMinLevelBound)
     {
         LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) | is below 85% of the LFG min level of {} and will not affect the map's stats.", creature->GetName(), creatureDSInfo->UnmodifiedLevel, mapDSInfo->lfgMinLevel);
         return;
     }
 
     // if the creature level is above 125% of the maximum LFG level, assume it's a flavor creature or holiday boss and shouldn't be tracked
-    if (creatureDSInfo->UnmodifiedLevel > (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f))
+    if (creatureDSInfo->UnmodifiedLevel > mapDSInfo->lfgMaxLevelBound)
     {
         LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) | is above 115% of the LFG max level of {} and will not affect the map's stats.", creature->GetName(), creatureDSInfo->UnmodifiedLevel, mapDSInfo->lfgMaxLevel);
         return;
@@ -2015,6 +1865,31 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
     {
         mapDSInfo->allMapCreatures.push_back(creature);
         creatureDSInfo->isInCreatureList = true;
+
+        if (mapDSInfo->recorder)
+        {
+            uint64 now = GetSteadyTimeMS();
+            DungeonScaleStatModifiers const* creatureOverride = templateInfo.creatureOverride;
+
+            // nullptr once the recording's creature table is full, the recorder counts what it had to drop
+            if (DungeonScaleRecord* record = mapDSInfo->recorder->AppendCreature(DUNGEONSCALE_RECORD_CREATURE_ADDED, creature->GetEntry(), now, creatureOverride ? 1 : 0))
+            {
+                record->playerCount = mapDSInfo->adjustedPlayerCount;
+                record->values[0] = creatureDSInfo->UnmodifiedLevel;
+
+                // the replay needs the creature's own stat modifiers, room for them was checked along with the record above
+                if (creatureOverride)
+                {
+                    DungeonScaleRecord* overrideRecord = mapDSInfo->recorder->AppendCreature(DUNGEONSCALE_RECORD_CREATURE_OVERRIDE, creature->GetEntry(), now);
+                    overrideRecord->values[0] = creatureOverride->global;
+                    overrideRecord->values[1] = creatureOverride->health;
+                    overrideRecord->values[2] = creatureOverride->mana;
+                    overrideRecord->values[3] = creatureOverride->armor;
+                    overrideRecord->values[4] = creatureOverride->damage;
+                    overrideRecord->values[5] = creatureOverride->ccduration;
+                }
+            }
+        }
         LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) | is #{} in the creature list.", creature->GetName(), creatureDSInfo->UnmodifiedLevel, mapDSInfo->allMapCreatures.size());
     }
 
@@ -2040,6 +1915,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
     if (isIncludedInMapStats)
     {
         // if the creature is vendor, trainer, or has gossip, don't use it to update map stats
+        // npc and unit flags are read live, scripts can change both at runtime
         if  ((creature->IsVendor() ||
                 creature->HasNpcFlag(UNIT_NPC_FLAG_GOSSIP) ||
                 creature->HasNpcFlag(UNIT_NPC_FLAG_QUESTGIVER) ||
@@ -2048,7 +1924,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
                 creature->HasNpcFlag(UNIT_NPC_FLAG_REPAIR) ||
                 creature->HasUnitFlag(UNIT_FLAG_IMMUNE_TO_PC) ||
                 creature->HasUnitFlag(UNIT_FLAG_NOT_SELECTABLE)) &&
-                (!isBossOrBossSummon(creature))
+                (!creatureDSInfo->isBoss)
             )
         {
             LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) | is a a vendor, trainer, or is otherwise not attackable - do not include in map stats.", creature->GetName(), creatureDSInfo->UnmodifiedLevel);
@@ -2068,7 +1944,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
                 }
 
                 // if the creature is friendly and not a boss
-                if (creature->IsFriendlyTo(thisPlayer) && !isBossOrBossSummon(creature))
+                if (creature->IsFriendlyTo(thisPlayer) && !creatureDSInfo->isBoss)
                 {
                     LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: Creature {} ({}) | is friendly to {} - do not include in map stats.",
                         creature->GetName(),
@@ -2109,6 +1985,7 @@ void AddCreatureToMapCreatureList(Creature* creature, bool addToCreatureList = t
         if (round(oldAvgCreatureLevel) != round(newAvgCreatureLevel))
         {
             mapDSInfo->mapConfigTime = 1;
+            SetRescaleTrigger(mapDSInfo, DUNGEONSCALE_RESCALE_TRIGGER_MAP_LEVEL);
             LOG_DEBUG("module.DungeonScale", "DungeonScale::AddCreatureToMapCreatureList: {} ({}{}) | average creature level changes {}->{}. Force map update. {} ({}{}) map config set to ({}).",
                 instanceMap->GetMapName(),
                 instanceMap->GetId(),
@@ -2145,6 +2022,13 @@ void RemoveCreatureFromMapData(Creature* creature)
                 DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
                 creatureDSInfo->isInCreatureList = false;
 
+                // it left the map before a player got near enough to need its new scaling
+                if (creatureDSInfo->isRescaleDeferred)
+                {
+                    creatureDSInfo->isRescaleDeferred = false;
+                    mapDSInfo->rescalesAvoided++;
+                }
+
                 // decrement the active creature counter if they were considered active
                 if (creatureDSInfo->isActive)
                 {
@@ -2172,6 +2056,48 @@ void RemoveCreatureFromMapData(Creature* creature)
             }
         }
     }
+
+    // forget any money modifier recorded for this creature's loot
+    if (!mapDSInfo->lootMoneyModifiers.empty())
+    {
+        mapDSInfo->lootMoneyModifiers.erase(creature->GetGUID());
+    }
+
+    // forget the released info of a creature that isn't relevant
+    if (!mapDSInfo->notRelevantCreatures.empty())
+    {
+        mapDSInfo->notRelevantCreatures.erase(creature->GetGUID());
+    }
+}
+
+void UpdateMapRewardProfile(Map* map)
+{
+    // if this isn't a dungeon instance, just bail out immediately
+    if (!map->IsDungeon() || !map->GetInstanceId())
+    {
+        return;
+    }
+
+    DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+    InstanceMap* instanceMap = map->ToInstanceMap();
+    uint32 maxPlayerCount = instanceMap->GetMaxPlayers();
+
+    // the reward hooks fire for every kill and every loot, so everything they need
+    // is resolved here once per player count or config change
+    mapDSInfo->rewardScalingXP = mapDSInfo->enabled && RewardScalingXP;
+    mapDSInfo->rewardScalingMoney = mapDSInfo->enabled && RewardScalingMoney;
+    mapDSInfo->rewardFixedXPRatio = maxPlayerCount ? (float)mapDSInfo->playerCount / maxPlayerCount : 1.0f;
+    mapDSInfo->rewardFixedMoneyRatio = maxPlayerCount ? (float)mapDSInfo->adjustedPlayerCount / maxPlayerCount : 1.0f;
+
+    LOG_DEBUG("module.DungeonScale", "DungeonScale::UpdateMapRewardProfile: Map {} ({}{}) | XP scaling {} (fixed ratio {}), money scaling {} (fixed ratio {}).",
+        instanceMap->GetMapName(),
+        instanceMap->GetId(),
+        instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
+        mapDSInfo->rewardScalingXP ? "ENABLED" : "DISABLED",
+        mapDSInfo->rewardFixedXPRatio,
+        mapDSInfo->rewardScalingMoney ? "ENABLED" : "DISABLED",
+        mapDSInfo->rewardFixedMoneyRatio
+    );
 }
 
 void UpdateMapPlayerStats(Map* map)
@@ -2217,36 +2143,29 @@ void UpdateMapPlayerStats(Map* map)
         mapDSInfo->combatLockMinPlayers
     );
 
-    uint8 adjustedPlayerCount = 0;
-
-    // if combat is locked and the new player count is higher than the combat lock, update the combat lock
-    if
-    (
-        mapDSInfo->combatLocked &&
-        mapDSInfo->playerCount > oldPlayerCount &&
-        mapDSInfo->playerCount > mapDSInfo->combatLockMinPlayers
-    )
+    // start with the actual player count (or the combat lock floor), then apply the minimum, the override and the offset
+    uint8 oldCombatLockMinPlayers = mapDSInfo->combatLockMinPlayers;
+    uint8 adjustedPlayerCount = CalculateAdjustedPlayerCount(
+        engineConfig,
+        mapDSInfo->playerCount,
+        oldPlayerCount,
+        mapDSInfo->minPlayers,
+        mapDSInfo->overridePlayerCount,
+        mapDSInfo->combatLocked,
+        mapDSInfo->combatLockMinPlayers
+    );
+
+    if (mapDSInfo->combatLockMinPlayers != oldCombatLockMinPlayers)
     {
-        // start with the actual player count
-        adjustedPlayerCount = mapDSInfo->playerCount;
-
-        // this is the new floor
-        mapDSInfo->combatLockMinPlayers = mapDSInfo->playerCount;
-
         LOG_DEBUG("module.DungeonScale_CombatLocking", "DungeonScale::UpdateMapPlayerStats: Map {} ({}{}) | Combat is locked. Combat floor increased. New floor is ({}).",
             instanceMap->GetMapName(),
             instanceMap->GetId(),
             instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
             mapDSInfo->combatLockMinPlayers
         );
-
     }
-    // if combat is otherwise locked
     else if (mapDSInfo->combatLocked)
     {
-        // start with the saved floor
-        adjustedPlayerCount = mapDSInfo->combatLockMinPlayers ? mapDSInfo->combatLockMinPlayers : mapDSInfo->playerCount;
-
         LOG_DEBUG("module.DungeonScale_CombatLocking", "DungeonScale::UpdateMapPlayerStats: Map {} ({}{}) | Combat is locked. Combat floor is ({}).",
             instanceMap->GetMapName(),
             instanceMap->GetId(),
@@ -2254,22 +2173,31 @@ void UpdateMapPlayerStats(Map* map)
             mapDSInfo->combatLockMinPlayers
         );
     }
-    // if combat is not locked
-    else
-    {
-        // start with the actual player count
-        adjustedPlayerCount = mapDSInfo->playerCount;
-    }
 
-    // if the adjusted player count is below the min players setting, adjust it
-    if (adjustedPlayerCount < mapDSInfo->minPlayers)
-        adjustedPlayerCount = mapDSInfo->minPlayers;
+    // hold the current difficulty until a change has been stable for the configured delay
+    // overrides (`.dungeonscale setplayers`) and the first calculation for the map apply right away
+    uint8 calculatedAdjustedPlayerCount = adjustedPlayerCount;
+    adjustedPlayerCount = ApplyPlayerCountChangeDelay(
+        engineConfig,
+        adjustedPlayerCount,
+        oldAdjustedPlayerCount,
+        mapDSInfo->overridePlayerCount,
+        GameTime::GetGameTimeMS().count(),
+        mapDSInfo->pendingAdjustedPlayerCount,
+        mapDSInfo->pendingAdjustedPlayerCountTime
+    );
 
-    // adjust by the override, or the PlayerDifficultyOffset
-    if (mapDSInfo->overridePlayerCount > 0)
-        adjustedPlayerCount = mapDSInfo->overridePlayerCount;
-    else
-        adjustedPlayerCount += PlayerCountDifficultyOffset;
+    if (adjustedPlayerCount != calculatedAdjustedPlayerCount)
+    {
+        LOG_DEBUG("module.DungeonScale", "DungeonScale::UpdateMapPlayerStats: Map {} ({}{}) | Player difficulty change ({}->{}) is pending for {}ms.",
+            instanceMap->GetMapName(),
+            instanceMap->GetId(),
+            instanceMap->GetInstanceId() ? "-" + std::to_string(instanceMap->GetInstanceId()) : "",
+            oldAdjustedPlayerCount,
+            calculatedAdjustedPlayerCount,
+            GetPlayerCountChangeDelay(engineConfig, calculatedAdjustedPlayerCount, oldAdjustedPlayerCount)
+        );
+    }
 
     // store the adjusted player count in the map's info
     mapDSInfo->adjustedPlayerCount = adjustedPlayerCount;
@@ -2278,6 +2206,7 @@ void UpdateMapPlayerStats(Map* map)
     if (oldAdjustedPlayerCount != mapDSInfo->adjustedPlayerCount)
     {
         mapDSInfo->mapConfigTime = 1;
+        SetRescaleTrigger(mapDSInfo, mapDSInfo->adjustedPlayerCount > oldAdjustedPlayerCount ? DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_JOIN : DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_LEAVE);
         LOG_DEBUG("module.DungeonScale_CombatLocking", "DungeonScale::UpdateMapPlayerStats: Map {} ({}{}) | Player difficulty changes ({}->{}). Force map update. {} ({}{}) map config time set to ({}).",
             instanceMap->GetMapName(),
             instanceMap->GetId(),
@@ -2344,6 +2273,9 @@ void UpdateMapPlayerStats(Map* map)
             mapDSInfo->adjustedPlayerCount
         );
     }
+
+    // the reward ratios depend on the player counts, so refresh them now
+    UpdateMapRewardProfile(map);
 }
 
 void AddPlayerToMap(Map* map, Player* player)
@@ -2384,6 +2316,17 @@ void AddPlayerToMap(Map* map, Player* player)
 
     // add the player to the map's player list
     mapDSInfo->allMapPlayers.push_back(player);
+
+    // the map is in use again, any rescales that were put off are picked up by the creature updates
+    if (mapDSInfo->isDormant)
+    {
+        mapDSInfo->isDormant = false;
+        LOG_DEBUG("module.DungeonScale", "DungeonScale::AddPlayerToMap: Map {} ({}{}) | is no longer dormant.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
+        );
+    }
     LOG_DEBUG("module.DungeonScale", "DungeonScale::AddPlayerToMap: Player {} ({}) | added to the map's player list.", player->GetName(), player->GetLevel());
 
     // update the map's player stats
@@ -2406,6 +2349,17 @@ bool RemovePlayerFromMap(Map* map, Player* player)
     mapDSInfo->allMapPlayers.erase(std::remove(mapDSInfo->allMapPlayers.begin(), mapDSInfo->allMapPlayers.end(), player), mapDSInfo->allMapPlayers.end());
     LOG_DEBUG("module.DungeonScale", "DungeonScale::RemovePlayerFromMap: Player {} ({}) | removed from the map's player list.", player->GetName(), player->GetLevel());
 
+    // with the last non-GM player gone, the map's creatures don't need any processing until someone enters again
+    if (mapDSInfo->allMapPlayers.empty())
+    {
+        mapDSInfo->isDormant = true;
+        LOG_DEBUG("module.DungeonScale", "DungeonScale::RemovePlayerFromMap: Map {} ({}{}) | has no players left and is now dormant.",
+            map->GetMapName(),
+            map->GetId(),
+            map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
+        );
+    }
+
     // if the map is combat locked, schedule a map update for when combat ends
     if (mapDSInfo->combatLocked)
     {
@@ -2420,12 +2374,23 @@ bool RemovePlayerFromMap(Map* map, Player* player)
 
 bool UpdateMapDataIfNeeded(Map* map, bool force = false)
 {
+    DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_UPDATE_MAP_DATA_IF_NEEDED);
+
     // get map data
     DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
 
+    // a pending difficulty change may have become stable since the last player stats update
+    if (IsPendingPlayerCountChangeDue(engineConfig, mapDSInfo->pendingAdjustedPlayerCount, mapDSInfo->adjustedPlayerCount,
+                                      mapDSInfo->pendingAdjustedPlayerCountTime, GameTime::GetGameTimeMS().count()))
+    {
+        UpdateMapPlayerStats(map);
+    }
+
     // if map needs update
     if (force || mapDSInfo->globalConfigTime < globalConfigTime || mapDSInfo->mapConfigTime < mapDSInfo->globalConfigTime)
     {
+        DungeonScaleTraceScope traceScope("UpdateMapDataIfNeeded", map->GetId(), map->GetInstanceId());
+        DUNGEONSCALE_PROBE3(map__reconfigure__start, map->GetId(), map->GetInstanceId(), mapDSInfo->adjustedPlayerCount);
 
         LOG_DEBUG("module.DungeonScale", "DungeonScale::UpdateMapDataIfNeeded: Map {} ({}{}) | globalConfigTime = ({}) | mapConfigTime = ({})",
                     map->GetMapName(),
@@ -2467,6 +2432,9 @@ bool UpdateMapDataIfNeeded(Map* map, bool force = false)
                         map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
             );
 
+            // a map that was never configured is new, not reloaded
+            SetRescaleTrigger(mapDSInfo, mapDSInfo->globalConfigTime == 1 ? DUNGEONSCALE_RESCALE_TRIGGER_MAP_CREATED : DUNGEONSCALE_RESCALE_TRIGGER_CONFIG_RELOAD);
+
             // clear the map's player list
             mapDSInfo->allMapPlayers.clear();
 
@@ -2497,6 +2465,9 @@ bool UpdateMapDataIfNeeded(Map* map, bool force = false)
                 AddPlayerToMap(map, thisPlayer);
             }
 
+            // the list was rebuilt from scratch, so is the dormancy (players still zoning in aren't in it yet)
+            mapDSInfo->isDormant = mapDSInfo->allMapPlayers.empty();
+
             // map's player count will be updated in UpdateMapPlayerStats below
         }
 
@@ -2519,6 +2490,7 @@ bool UpdateMapDataIfNeeded(Map* map, bool force = false)
         if (mapDSInfo->enabled != newEnabled)
         {
             mapDSInfo->mapConfigTime = 1;
+            SetRescaleTrigger(mapDSInfo, DUNGEONSCALE_RESCALE_TRIGGER_ENABLED_STATE);
 
             LOG_DEBUG("module.DungeonScale", "DungeonScale::UpdateMapDataIfNeeded: Map {} ({}{}) | Enabled state transitions from {}->{}, map update forced. Map config time set to ({}).",
                 map->GetMapName(),
@@ -2552,21 +2524,18 @@ bool UpdateMapDataIfNeeded(Map* map, bool force = false)
         // update the map's player stats
         UpdateMapPlayerStats(map);
 
-        // World multipliers only need to be updated if the mapLevel has changed OR if the map config is out of date
-        if (mapDSInfo->prevMapLevel != mapDSInfo->mapLevel || isMapConfigOutOfDate)
-        {
-            // Update World Health multiplier
-            // Used for scaling damage against destructible game objects
-            mapDSInfo->worldHealthMultiplier = getWorldMultiplier(map, BaseValueType::DUNGEONSCALE_HEALTH);
-
-            // Update World Damage or Healing multiplier
-            // Used for scaling damage and healing between players and/or non-creatures
-            mapDSInfo->worldDamageHealingMultiplier = getWorldMultiplier(map, BaseValueType::DUNGEONSCALE_DAMAGE_HEALING);
-        }
+        // Update the World Health multiplier (used for scaling damage against destructible game objects)
+        // and the World Damage or Healing multiplier (used for scaling damage and healing between players and/or non-creatures)
+        // they are only recalculated when the inputs they were last calculated from have changed
+        UpdateWorldMultipliers(map);
 
         // mark the config updated
         mapDSInfo->globalConfigTime = globalConfigTime;
         mapDSInfo->mapConfigTime = GetCurrentConfigTime();
+        StartRescaleWave(map, mapDSInfo);
+
+        // summon profiles were computed for the previous config time
+        mapDSInfo->summonProfiles.clear();
 
         LOG_DEBUG("module.DungeonScale", "DungeonScale::UpdateMapDataIfNeeded: {} ({}{}) | Global config time set to ({}).",
                     map->GetMapName(),
@@ -2623,6 +2592,99 @@ int GetForcedNumPlayers(int creatureId)
     return forcedCreatureIds[creatureId];
 }
 
+void LoadCreatureTemplateInfo() // Resolves the per-entry classification once so the creature hooks don't have to
+{
+    creatureTemplateInfos.clear();
+    creatureBaseStats.clear();
+
+    CreatureTemplateContainer const* creatureTemplates = sObjectMgr->GetCreatureTemplates();
+    if (!creatureTemplates)
+        return;
+
+    size_t baseStatsCount = 0;
+
+    for (auto const& [entry, creatureTemplate] : *creatureTemplates)
+    {
+        // the original stats only depend on the template and the level, generate the whole range up front
+        DungeonScaleTemplateBaseStats& templateBaseStats = creatureBaseStats[entry];
+        templateBaseStats.minLevel = creatureTemplate.minlevel;
+
+        uint8 maxLevel = std::max(creatureTemplate.minlevel, creatureTemplate.maxlevel);
+        templateBaseStats.levels.reserve(maxLevel - creatureTemplate.minlevel + 1);
+
+        for (uint32 level = creatureTemplate.minlevel; level <= maxLevel; ++level)
+            templateBaseStats.levels.push_back(GenerateCreatureBaseStats(&creatureTemplate, level));
+
+        baseStatsCount += templateBaseStats.levels.size();
+
+        DungeonScaleCreatureTemplateInfo templateInfo;
+        templateInfo.isCritter = creatureTemplate.type == CREATURE_TYPE_CRITTER;
+        templateInfo.isTrigger = (creatureTemplate.flags_extra & CREATURE_FLAG_EXTRA_TRIGGER) != 0;
+        templateInfo.forcedNumPlayers = GetForcedNumPlayers(entry);
+
+        templateInfo.creatureOverride = FindCreatureStatModifierOverride(engineConfig, entry);
+
+        // don't store entries that would resolve to the default anyway
+        if (!templateInfo.isCritter && !templateInfo.isTrigger &&
+            templateInfo.forcedNumPlayers == -1 && !templateInfo.creatureOverride)
+            continue;
+
+        creatureTemplateInfos.emplace(entry, templateInfo);
+    }
+
+    LOG_INFO("module.DungeonScale", "DungeonScale::LoadCreatureTemplateInfo: Cached classification for {} of {} creature templates and {} template levels of base stats.",
+                creatureTemplateInfos.size(),
+                creatureTemplates->size(),
+                baseStatsCount
+    );
+}
+
+void LoadLFGLevelRanges() // Resolves the LFG level range of every instanceable map and difficulty, including the heroic-to-normal fallback
+{
+    lfgLevelsByMapDifficulty.clear();
+
+    for (uint32 mapId = 0; mapId < sMapStore.GetNumRows(); ++mapId)
+    {
+        MapEntry const* mapEntry = sMapStore.LookupEntry(mapId);
+        if (!mapEntry || !mapEntry->IsDungeon())
+            continue;
+
+        for (uint8 difficulty = 0; difficulty < MAX_DIFFICULTY; ++difficulty)
+        {
+            DungeonScaleLFGLevels lfgLevels;
+            LFGDungeonEntry const* dungeon = GetLFGDungeon(mapId, Difficulty(difficulty));
+
+            // if this is a heroic difficulty that isn't in LFG, get the levels from the non-heroic version
+            if (!dungeon)
+            {
+                if (!mapEntry->IsRaid() && difficulty == DUNGEON_DIFFICULTY_HEROIC)
+                    dungeon = GetLFGDungeon(mapId, DUNGEON_DIFFICULTY_NORMAL);
+                else if (mapEntry->IsRaid() && difficulty == RAID_DIFFICULTY_10MAN_HEROIC)
+                    dungeon = GetLFGDungeon(mapId, RAID_DIFFICULTY_10MAN_NORMAL);
+                else if (mapEntry->IsRaid() && difficulty == RAID_DIFFICULTY_25MAN_HEROIC)
+                    dungeon = GetLFGDungeon(mapId, RAID_DIFFICULTY_25MAN_NORMAL);
+
+                lfgLevels.isFromNormalDifficulty = true;
+            }
+
+            if (!dungeon)
+                continue;
+
+            lfgLevels.minLevel = dungeon->MinLevel;
+            lfgLevels.maxLevel = dungeon->MaxLevel;
+            lfgLevels.targetLevel = dungeon->TargetLevel;
+            lfgLevels.minLevelBound = (uint8)(((float)lfgLevels.minLevel * .85f) + 0.5f);
+            lfgLevels.maxLevelBound = (uint8)(((float)lfgLevels.maxLevel * 1.15f) + 0.5f);
+
+            lfgLevelsByMapDifficulty.emplace((mapId << 8) | difficulty, lfgLevels);
+        }
+    }
+
+    LOG_INFO("module.DungeonScale", "DungeonScale::LoadLFGLevelRanges: Cached LFG level ranges for {} map difficulties.",
+                lfgLevelsByMapDifficulty.size()
+    );
+}
+
 void SendMessageToDungeonPlayersExceptPlayer(Player* player, std::string message)
 {
     if (player->GetMap()->IsDungeon() == false)
@@ -2645,23 +2707,51 @@ class DungeonScale_WorldScript : public WorldScript
     {
     }
 
-    void OnBeforeConfigLoad(bool /*reload*/) override
+    void OnBeforeConfigLoad(bool reload) override
     {
-        SetInitialWorldSettings();
+        std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+
+        // tracing can only be on by the time of a reload
+        {
+            DungeonScaleTraceScope traceScope("SetInitialWorldSettings", 0, 0);
+            SetInitialWorldSettings();
+        }
+
         globalConfigTime = GetCurrentConfigTime();
 
+        // creature templates aren't loaded yet on the initial config load, OnStartup takes care of that one
+        if (reload)
+        {
+            DungeonScaleTraceScope traceScope("LoadCreatureTemplateInfo", 0, 0);
+            LoadCreatureTemplateInfo();
+        }
+
+        SetMetricsConfigReloadDuration(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - loadStart).count());
+
         LOG_INFO("module.DungeonScale", "DungeonScale::OnBeforeConfigLoad: Config loaded. Global config time set to ({}).", globalConfigTime);
     }
 
+    void OnStartup() override
+    {
+        LoadCreatureTemplateInfo();
+        LoadLFGLevelRanges();
+    }
+
+    void OnShutdown() override
+    {
+        StopMetricsExport();
+        StopTrace();
+    }
+
     void SetInitialWorldSettings()
     {
         forcedCreatureIds.clear();
         disabledDungeonIds.clear();
-        dungeonOverrides.clear();
-        bossOverrides.clear();
-        statModifierOverrides.clear();
-        statModifierBossOverrides.clear();
-        statModifierCreatureOverrides.clear();
+        engineConfig.dungeonOverrides.clear();
+        engineConfig.bossOverrides.clear();
+        engineConfig.statModifierOverrides.clear();
+        engineConfig.statModifierBossOverrides.clear();
+        engineConfig.statModifierCreatureOverrides.clear();
 
         LoadForcedCreatureIdsFromString(sConfigMgr->GetOption<std::string>("DungeonScale.ForcedID40", ""), 40);
         LoadForcedCreatureIdsFromString(sConfigMgr->GetOption<std::string>("DungeonScale.ForcedID25", ""), 25);
@@ -2685,23 +2775,23 @@ class DungeonScale_WorldScript : public WorldScript
         ); // `DungeonScale.PerDungeonPlayerCounts` for backwards compatibility
 
         // Overrides
-        dungeonOverrides = LoadInflectionPointOverrides(
+        engineConfig.dungeonOverrides = LoadInflectionPointOverrides(
             sConfigMgr->GetOption<std::string>("DungeonScale.InflectionPoint.PerInstance",sConfigMgr->GetOption<std::string>("DungeonScale.PerDungeonScaling", "", false), false)
         ); // `DungeonScale.PerDungeonScaling` for backwards compatibility
 
-        bossOverrides = LoadInflectionPointOverrides(
+        engineConfig.bossOverrides = LoadInflectionPointOverrides(
             sConfigMgr->GetOption<std::string>("DungeonScale.InflectionPoint.Boss.PerInstance", sConfigMgr->GetOption<std::string>("DungeonScale.PerDungeonBossScaling", "", false), false)
         ); // `DungeonScale.PerDungeonBossScaling` for backwards compatibility
 
-        statModifierOverrides = LoadStatModifierOverrides(
+        engineConfig.statModifierOverrides = LoadStatModifierOverrides(
             sConfigMgr->GetOption<std::string>("DungeonScale.StatModifier.PerInstance", "", false)
         );
 
-        statModifierBossOverrides = LoadStatModifierOverrides(
+        engineConfig.statModifierBossOverrides = LoadStatModifierOverrides(
             sConfigMgr->GetOption<std::string>("DungeonScale.StatModifier.Boss.PerInstance", "", false)
         );
 
-        statModifierCreatureOverrides = LoadStatModifierOverrides(
+        engineConfig.statModifierCreatureOverrides = LoadStatModifierOverrides(
             sConfigMgr->GetOption<std::string>("DungeonScale.StatModifier.PerCreature", "", false)
         );
 
@@ -2724,239 +2814,239 @@ class DungeonScale_WorldScript : public WorldScript
         // Misc Settings
         // TODO: Organize and standardize variable names
         PlayerChangeNotify = sConfigMgr->GetOption<bool>("DungeonScale.PlayerChangeNotify", 1);
-        PlayerCountDifficultyOffset = sConfigMgr->GetOption<uint32>("DungeonScale.playerCountDifficultyOffset", 0);
+        engineConfig.playerCountDifficultyOffset = sConfigMgr->GetOption<uint32>("DungeonScale.playerCountDifficultyOffset", 0);
 
         // InflectionPoint*
-        InflectionPoint =                           sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint", 0.5f, false);
-        InflectionPointCurveFloor =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint.CurveFloor", 0.0f, false);
-        InflectionPointCurveCeiling =               sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint.CurveCeiling", 1.0f, false);
-        InflectionPointBoss =                       sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
-
-        InflectionPointHeroic =                     sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic", 0.5f, false);
-        InflectionPointHeroicCurveFloor =           sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic.CurveFloor", 0.0f, false);
-        InflectionPointHeroicCurveCeiling =         sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic.CurveCeiling", 1.0f, false);
-        InflectionPointHeroicBoss =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
-
-        InflectionPointRaid =                       sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid", 0.5f, false);
-        InflectionPointRaidCurveFloor =             sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid.CurveFloor", 0.0f, false);
-        InflectionPointRaidCurveCeiling =           sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid.CurveCeiling", 1.0f, false);
-        InflectionPointRaidBoss =                   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
-
-        InflectionPointRaidHeroic =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic", 0.5f, false);
-        InflectionPointRaidHeroicCurveFloor =       sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic.CurveFloor", 0.0f, false);
-        InflectionPointRaidHeroicCurveCeiling =     sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic.CurveCeiling", 1.0f, false);
-        InflectionPointRaidHeroicBoss =             sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
-
-        InflectionPointRaid10M =                    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M", InflectionPointRaid, false);
-        InflectionPointRaid10MCurveFloor =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M.CurveFloor", InflectionPointRaidCurveFloor, false);
-        InflectionPointRaid10MCurveCeiling =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-        InflectionPointRaid10MBoss =                sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M.BossModifier", InflectionPointRaidBoss, false);
-
-        InflectionPointRaid10MHeroic =              sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic", InflectionPointRaidHeroic, false);
-        InflectionPointRaid10MHeroicCurveFloor =    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic.CurveFloor", InflectionPointRaidHeroicCurveFloor, false);
-        InflectionPointRaid10MHeroicCurveCeiling =  sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic.CurveCeiling", InflectionPointRaidHeroicCurveCeiling, false);
-        InflectionPointRaid10MHeroicBoss =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic.BossModifier", InflectionPointRaidHeroicBoss, false);
-
-        InflectionPointRaid15M =                    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M", InflectionPointRaid, false);
-        InflectionPointRaid15MCurveFloor =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M.CurveFloor", InflectionPointRaidCurveFloor, false);
-        InflectionPointRaid15MCurveCeiling =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-        InflectionPointRaid15MBoss =                sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M.BossModifier", InflectionPointRaidBoss, false);
-
-        InflectionPointRaid20M =                    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M", InflectionPointRaid, false);
-        InflectionPointRaid20MCurveFloor =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M.CurveFloor", InflectionPointRaidCurveFloor, false);
-        InflectionPointRaid20MCurveCeiling =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-        InflectionPointRaid20MBoss =                sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M.BossModifier", InflectionPointRaidBoss, false);
-
-        InflectionPointRaid25M =                    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M", InflectionPointRaid, false);
-        InflectionPointRaid25MCurveFloor =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M.CurveFloor", InflectionPointRaidCurveFloor, false);
-        InflectionPointRaid25MCurveCeiling =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-        InflectionPointRaid25MBoss =                sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M.BossModifier", InflectionPointRaidBoss, false);
-
-        InflectionPointRaid25MHeroic =              sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic", InflectionPointRaidHeroic, false);
-        InflectionPointRaid25MHeroicCurveFloor =    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic.CurveFloor", InflectionPointRaidHeroicCurveFloor, false);
-        InflectionPointRaid25MHeroicCurveCeiling =  sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic.CurveCeiling", InflectionPointRaidHeroicCurveCeiling, false);
-        InflectionPointRaid25MHeroicBoss =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic.BossModifier", InflectionPointRaidHeroicBoss, false);
-
-        InflectionPointRaid40M =                    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M", InflectionPointRaid, false);
-        InflectionPointRaid40MCurveFloor =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M.CurveFloor", InflectionPointRaidCurveFloor, false);
-        InflectionPointRaid40MCurveCeiling =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M.CurveCeiling", InflectionPointRaidCurveCeiling, false);
-        InflectionPointRaid40MBoss =                sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M.BossModifier", InflectionPointRaidBoss, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M].value =                  sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint", 0.5f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M].curveFloor =             sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint.CurveFloor", 0.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M].curveCeiling =           sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint.CurveCeiling", 1.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M].bossModifier =           sConfigMgr->GetOption<float>("DungeonScale.InflectionPoint.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M_HEROIC].value =           sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic", 0.5f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M_HEROIC].curveFloor =      sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic.CurveFloor", 0.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M_HEROIC].curveCeiling =    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic.CurveCeiling", 1.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_5M_HEROIC].bossModifier =    sConfigMgr->GetOption<float>("DungeonScale.InflectionPointHeroic.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].value =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid", 0.5f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveFloor =   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid.CurveFloor", 0.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveCeiling = sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid.CurveCeiling", 1.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].bossModifier = sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].value =        sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic", 0.5f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].curveFloor =   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic.CurveFloor", 0.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].curveCeiling = sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic.CurveCeiling", 1.0f, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].bossModifier = sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaidHeroic.BossModifier", sConfigMgr->GetOption<float>("DungeonScale.BossInflectionMult", 1.0f, false), false); // `DungeonScale.BossInflectionMult` for backwards compatibility
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M].value =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M].curveFloor =            sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M].curveCeiling =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M].bossModifier =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10M.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].bossModifier, false);
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M_HEROIC].value =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M_HEROIC].curveFloor =     sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M_HEROIC].curveCeiling =   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_10M_HEROIC].bossModifier =   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid10MHeroic.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].bossModifier, false);
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_15M].value =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_15M].curveFloor =            sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_15M].curveCeiling =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_15M].bossModifier =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid15M.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].bossModifier, false);
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_20M].value =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_20M].curveFloor =            sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_20M].curveCeiling =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_20M].bossModifier =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid20M.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].bossModifier, false);
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M].value =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M].curveFloor =            sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M].curveCeiling =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M].bossModifier =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25M.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].bossModifier, false);
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M_HEROIC].value =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M_HEROIC].curveFloor =     sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M_HEROIC].curveCeiling =   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_25M_HEROIC].bossModifier =   sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid25MHeroic.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].bossModifier, false);
+
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_40M].value =                 sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].value, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_40M].curveFloor =            sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M.CurveFloor", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveFloor, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_40M].curveCeiling =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M.CurveCeiling", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].curveCeiling, false);
+        engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_40M].bossModifier =          sConfigMgr->GetOption<float>("DungeonScale.InflectionPointRaid40M.BossModifier", engineConfig.inflectionPoints[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].bossModifier, false);
 
         // StatModifier*
         // 5-player dungeons
-        StatModifier_Global =                       sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifier_Health =                       sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifier_Mana =                         sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifier_Armor =                        sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifier_Damage =                       sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifier_CCDuration =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifier.CCDuration", -1.0f, false);
-
-        StatModifier_Boss_Global =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifier_Boss_Health =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifier_Boss_Mana =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifier_Boss_Armor =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifier_Boss_Damage =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifier_Boss_CCDuration =              sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.CCDuration", -1.0f, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M].global =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M].health =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M].mana =                      sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M].armor =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M].damage =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M].ccduration =                sConfigMgr->GetOption<float>("DungeonScale.StatModifier.CCDuration", -1.0f, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M].global =                sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M].health =                sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M].mana =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M].armor =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M].damage =                sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M].ccduration =            sConfigMgr->GetOption<float>("DungeonScale.StatModifier.Boss.CCDuration", -1.0f, false);
 
         // 5-player heroic dungeons
-        StatModifierHeroic_Global =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifierHeroic_Health =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifierHeroic_Mana =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifierHeroic_Armor =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifierHeroic_Damage =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifierHeroic_CCDuration =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.CCDuration", -1.0f, false);
-
-        StatModifierHeroic_Boss_Global =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifierHeroic_Boss_Health =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifierHeroic_Boss_Mana =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifierHeroic_Boss_Armor =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifierHeroic_Boss_Damage =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifierHeroic_Boss_CCDuration =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.CCDuration", -1.0f, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].global =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].health =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].mana =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].armor =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].damage =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].ccduration =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.CCDuration", -1.0f, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].global =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].health =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].mana =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].armor =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].damage =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_5M_HEROIC].ccduration =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierHeroic.Boss.CCDuration", -1.0f, false);
 
         // Default for all raids
-        StatModifierRaid_Global =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifierRaid_Health =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifierRaid_Mana =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifierRaid_Armor =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifierRaid_Damage =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifierRaid_CCDuration =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.CCDuration", -1.0f, false);
-
-        StatModifierRaid_Boss_Global =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifierRaid_Boss_Health =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifierRaid_Boss_Mana =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifierRaid_Boss_Armor =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifierRaid_Boss_Damage =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifierRaid_Boss_CCDuration =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.CCDuration", -1.0f, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.CCDuration", -1.0f, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration =  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid.Boss.CCDuration", -1.0f, false);
 
         // Default for all heroic raids
-        StatModifierRaidHeroic_Global =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifierRaidHeroic_Health =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifierRaidHeroic_Mana =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifierRaidHeroic_Armor =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifierRaidHeroic_Damage =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifierRaidHeroic_CCDuration =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.CCDuration", -1.0f, false);
-
-        StatModifierRaidHeroic_Boss_Global =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
-        StatModifierRaidHeroic_Boss_Health =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
-        StatModifierRaidHeroic_Boss_Mana =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
-        StatModifierRaidHeroic_Boss_Armor =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
-        StatModifierRaidHeroic_Boss_Damage =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
-        StatModifierRaidHeroic_Boss_CCDuration =    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.CCDuration", -1.0f, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].global =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].health =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].mana =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].armor =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].damage =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].ccduration =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.CCDuration", -1.0f, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].global =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Global", sConfigMgr->GetOption<float>("DungeonScale.rate.global", 1.0f, false), false); // `DungeonScale.rate.global` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].health =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Health", sConfigMgr->GetOption<float>("DungeonScale.rate.health", 1.0f, false), false); // `DungeonScale.rate.health` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].mana =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Mana", sConfigMgr->GetOption<float>("DungeonScale.rate.mana", 1.0f, false), false); // `DungeonScale.rate.mana` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].armor =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Armor", sConfigMgr->GetOption<float>("DungeonScale.rate.armor", 1.0f, false), false); // `DungeonScale.rate.armor` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].damage =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.Damage", sConfigMgr->GetOption<float>("DungeonScale.rate.damage", 1.0f, false), false); // `DungeonScale.rate.damage` for backwards compatibility
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].ccduration =  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaidHeroic.Boss.CCDuration", -1.0f, false);
 
         // 10-player raids
-        StatModifierRaid10M_Global =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Global", StatModifierRaid_Global, false);
-        StatModifierRaid10M_Health =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Health", StatModifierRaid_Health, false);
-        StatModifierRaid10M_Mana =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Mana", StatModifierRaid_Mana, false);
-        StatModifierRaid10M_Armor =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Armor", StatModifierRaid_Armor, false);
-        StatModifierRaid10M_Damage =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Damage", StatModifierRaid_Damage, false);
-        StatModifierRaid10M_CCDuration =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.CCDuration", StatModifierRaid_CCDuration, false);
-
-        StatModifierRaid10M_Boss_Global =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Global", StatModifierRaid_Boss_Global, false);
-        StatModifierRaid10M_Boss_Health =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Health", StatModifierRaid_Boss_Health, false);
-        StatModifierRaid10M_Boss_Mana =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-        StatModifierRaid10M_Boss_Armor =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-        StatModifierRaid10M_Boss_Damage =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-        StatModifierRaid10M_Boss_CCDuration =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M].global =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M].health =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M].mana =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M].armor =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M].damage =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M].ccduration =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M].global =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M].health =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M].mana =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M].armor =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M].damage =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M].ccduration =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10M.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
 
         // 10-player heroic raids
-        StatModifierRaid10MHeroic_Global =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Global", StatModifierRaidHeroic_Global, false);
-        StatModifierRaid10MHeroic_Health =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Health", StatModifierRaidHeroic_Health, false);
-        StatModifierRaid10MHeroic_Mana =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Mana", StatModifierRaidHeroic_Mana, false);
-        StatModifierRaid10MHeroic_Armor =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Armor", StatModifierRaidHeroic_Armor, false);
-        StatModifierRaid10MHeroic_Damage =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Damage", StatModifierRaidHeroic_Damage, false);
-        StatModifierRaid10MHeroic_CCDuration =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.CCDuration", StatModifierRaidHeroic_CCDuration, false);
-
-        StatModifierRaid10MHeroic_Boss_Global =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Global", StatModifierRaidHeroic_Boss_Global, false);
-        StatModifierRaid10MHeroic_Boss_Health =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Health", StatModifierRaidHeroic_Boss_Health, false);
-        StatModifierRaid10MHeroic_Boss_Mana =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Mana", StatModifierRaidHeroic_Boss_Mana, false);
-        StatModifierRaid10MHeroic_Boss_Armor =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Armor", StatModifierRaidHeroic_Boss_Armor, false);
-        StatModifierRaid10MHeroic_Boss_Damage =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Damage", StatModifierRaidHeroic_Boss_Damage, false);
-        StatModifierRaid10MHeroic_Boss_CCDuration = sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.CCDuration", StatModifierRaidHeroic_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].global =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].health =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].mana =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].armor =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].damage =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].ccduration =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].global =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].health =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].mana =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].armor =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].damage =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_10M_HEROIC].ccduration =    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid10MHeroic.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].ccduration, false);
 
         // 15-player raids
-        StatModifierRaid15M_Global =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Global", StatModifierRaid_Global, false);
-        StatModifierRaid15M_Health =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Health", StatModifierRaid_Health, false);
-        StatModifierRaid15M_Mana =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Mana", StatModifierRaid_Mana, false);
-        StatModifierRaid15M_Armor =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Armor", StatModifierRaid_Armor, false);
-        StatModifierRaid15M_Damage =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Damage", StatModifierRaid_Damage, false);
-        StatModifierRaid15M_CCDuration =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.CCDuration", StatModifierRaid_CCDuration, false);
-
-        StatModifierRaid15M_Boss_Global =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Global", StatModifierRaid_Boss_Global, false);
-        StatModifierRaid15M_Boss_Health =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Health", StatModifierRaid_Boss_Health, false);
-        StatModifierRaid15M_Boss_Mana =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-        StatModifierRaid15M_Boss_Armor =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-        StatModifierRaid15M_Boss_Damage =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-        StatModifierRaid15M_Boss_CCDuration =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_15M].global =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_15M].health =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_15M].mana =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_15M].armor =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_15M].damage =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_15M].ccduration =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_15M].global =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_15M].health =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_15M].mana =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_15M].armor =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_15M].damage =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_15M].ccduration =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid15M.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
 
         // 20-player raids
-        StatModifierRaid20M_Global =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Global", StatModifierRaid_Global, false);
-        StatModifierRaid20M_Health =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Health", StatModifierRaid_Health, false);
-        StatModifierRaid20M_Mana =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Mana", StatModifierRaid_Mana, false);
-        StatModifierRaid20M_Armor =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Armor", StatModifierRaid_Armor, false);
-        StatModifierRaid20M_Damage =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Damage", StatModifierRaid_Damage, false);
-        StatModifierRaid20M_CCDuration =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.CCDuration", StatModifierRaid_CCDuration, false);
-
-        StatModifierRaid20M_Boss_Global =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Global", StatModifierRaid_Boss_Global, false);
-        StatModifierRaid20M_Boss_Health =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Health", StatModifierRaid_Boss_Health, false);
-        StatModifierRaid20M_Boss_Mana =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-        StatModifierRaid20M_Boss_Armor =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-        StatModifierRaid20M_Boss_Damage =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-        StatModifierRaid20M_Boss_CCDuration =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_20M].global =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_20M].health =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_20M].mana =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_20M].armor =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_20M].damage =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_20M].ccduration =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_20M].global =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_20M].health =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_20M].mana =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_20M].armor =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_20M].damage =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_20M].ccduration =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid20M.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
 
         // 25-player raids
-        StatModifierRaid25M_Global =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Global", StatModifierRaid_Global, false);
-        StatModifierRaid25M_Health =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Health", StatModifierRaid_Health, false);
-        StatModifierRaid25M_Mana =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Mana", StatModifierRaid_Mana, false);
-        StatModifierRaid25M_Armor =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Armor", StatModifierRaid_Armor, false);
-        StatModifierRaid25M_Damage =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Damage", StatModifierRaid_Damage, false);
-        StatModifierRaid25M_CCDuration =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.CCDuration", StatModifierRaid_CCDuration, false);
-
-        StatModifierRaid25M_Boss_Global =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Global", StatModifierRaid_Boss_Global, false);
-        StatModifierRaid25M_Boss_Health =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Health", StatModifierRaid_Boss_Health, false);
-        StatModifierRaid25M_Boss_Mana =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-        StatModifierRaid25M_Boss_Armor =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-        StatModifierRaid25M_Boss_Damage =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-        StatModifierRaid25M_Boss_CCDuration =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M].global =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M].health =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M].mana =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M].armor =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M].damage =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M].ccduration =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M].global =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M].health =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M].mana =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M].armor =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M].damage =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M].ccduration =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25M.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
 
         // 25-player heroic raids
-        StatModifierRaid25MHeroic_Global =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Global", StatModifierRaidHeroic_Global, false);
-        StatModifierRaid25MHeroic_Health =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Health", StatModifierRaidHeroic_Health, false);
-        StatModifierRaid25MHeroic_Mana =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Mana", StatModifierRaidHeroic_Mana, false);
-        StatModifierRaid25MHeroic_Armor =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Armor", StatModifierRaidHeroic_Armor, false);
-        StatModifierRaid25MHeroic_Damage =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Damage", StatModifierRaidHeroic_Damage, false);
-        StatModifierRaid25MHeroic_CCDuration =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.CCDuration", StatModifierRaidHeroic_CCDuration, false);
-
-        StatModifierRaid25MHeroic_Boss_Global =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Global", StatModifierRaidHeroic_Boss_Global, false);
-        StatModifierRaid25MHeroic_Boss_Health =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Health", StatModifierRaidHeroic_Boss_Health, false);
-        StatModifierRaid25MHeroic_Boss_Mana =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Mana", StatModifierRaidHeroic_Boss_Mana, false);
-        StatModifierRaid25MHeroic_Boss_Armor =      sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Armor", StatModifierRaidHeroic_Boss_Armor, false);
-        StatModifierRaid25MHeroic_Boss_Damage =     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Damage", StatModifierRaidHeroic_Boss_Damage, false);
-        StatModifierRaid25MHeroic_Boss_CCDuration = sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.CCDuration", StatModifierRaidHeroic_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].global =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].health =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].mana =              sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].armor =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].damage =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].ccduration =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].global =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].health =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].mana =          sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].armor =         sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].damage =        sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_25M_HEROIC].ccduration =    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid25MHeroic.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_HEROIC].ccduration, false);
 
         // 40-player raids
-        StatModifierRaid40M_Global =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Global", StatModifierRaid_Global, false);
-        StatModifierRaid40M_Health =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Health", StatModifierRaid_Health, false);
-        StatModifierRaid40M_Mana =                  sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Mana", StatModifierRaid_Mana, false);
-        StatModifierRaid40M_Armor =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Armor", StatModifierRaid_Armor, false);
-        StatModifierRaid40M_Damage =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Damage", StatModifierRaid_Damage, false);
-        StatModifierRaid40M_CCDuration =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.CCDuration", StatModifierRaid_CCDuration, false);
-
-        StatModifierRaid40M_Boss_Global =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Global", StatModifierRaid_Boss_Global, false);
-        StatModifierRaid40M_Boss_Health =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Health", StatModifierRaid_Boss_Health, false);
-        StatModifierRaid40M_Boss_Mana =             sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Mana", StatModifierRaid_Boss_Mana, false);
-        StatModifierRaid40M_Boss_Armor =            sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Armor", StatModifierRaid_Boss_Armor, false);
-        StatModifierRaid40M_Boss_Damage =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Damage", StatModifierRaid_Boss_Damage, false);
-        StatModifierRaid40M_Boss_CCDuration =       sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.CCDuration", StatModifierRaid_Boss_CCDuration, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_40M].global =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Global", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_40M].health =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Health", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_40M].mana =                     sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Mana", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_40M].armor =                    sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Armor", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_40M].damage =                   sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Damage", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_40M].ccduration =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.CCDuration", engineConfig.statModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
+
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_40M].global =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Global", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].global, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_40M].health =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Health", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].health, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_40M].mana =                 sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Mana", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].mana, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_40M].armor =                sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Armor", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].armor, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_40M].damage =               sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.Damage", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].damage, false);
+        engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_40M].ccduration =           sConfigMgr->GetOption<float>("DungeonScale.StatModifierRaid40M.Boss.CCDuration", engineConfig.bossStatModifiers[DUNGEONSCALE_INSTANCE_OTHER_NORMAL].ccduration, false);
 
         // Modifier Min/Max
-        MinHPModifier = sConfigMgr->GetOption<float>("DungeonScale.MinHPModifier", 0.1f);
-        MinManaModifier = sConfigMgr->GetOption<float>("DungeonScale.MinManaModifier", 0.01f);
-        MinDamageModifier = sConfigMgr->GetOption<float>("DungeonScale.MinDamageModifier", 0.01f);
-        MinCCDurationModifier = sConfigMgr->GetOption<float>("DungeonScale.MinCCDurationModifier", 0.25f);
-        MaxCCDurationModifier = sConfigMgr->GetOption<float>("DungeonScale.MaxCCDurationModifier", 1.0f);
+        engineConfig.multiplierLimits.minHealth = sConfigMgr->GetOption<float>("DungeonScale.MinHPModifier", 0.1f);
+        engineConfig.multiplierLimits.minMana = sConfigMgr->GetOption<float>("DungeonScale.MinManaModifier", 0.01f);
+        engineConfig.multiplierLimits.minDamage = sConfigMgr->GetOption<float>("DungeonScale.MinDamageModifier", 0.01f);
+        engineConfig.multiplierLimits.minCCDuration = sConfigMgr->GetOption<float>("DungeonScale.MinCCDurationModifier", 0.25f);
+        engineConfig.multiplierLimits.maxCCDuration = sConfigMgr->GetOption<float>("DungeonScale.MaxCCDurationModifier", 1.0f);
 
         // RewardScaling.*
-        RewardScalingExceptionItemIDs = ParseIntsFromString(sConfigMgr->GetOption<std::string>("DungeonScale.RewardScaling.Loot.ExceptionItemIDs", ""));
+        engineConfig.rewardScalingExceptionItemIDs = ParseIntsFromString(sConfigMgr->GetOption<std::string>("DungeonScale.RewardScaling.Loot.ExceptionItemIDs", ""));
 
         std::string RewardScalingMethodString = sConfigMgr->GetOption<std::string>("DungeonScale.RewardScaling.Method", "dynamic", false);
         if (RewardScalingMethodString == "fixed")
@@ -2979,10 +3069,59 @@ class DungeonScale_WorldScript : public WorldScript
         RewardScalingMoney = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Money", sConfigMgr->GetOption<bool>("DungeonScale.DungeonScaleDownMoney", true, false));
         RewardScalingMoneyModifier = sConfigMgr->GetOption<float>("DungeonScale.RewardScaling.Money.Modifier", 1.0f, false);
 
-        RewardScalingLoot = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot", true);
-        RewardScalingLootBOPAlwaysDropException = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot.BOPAlwaysDropException", true);
-        RewardScalingExemptContainers = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot.ExemptContainers", true);
-        RewardScalingExemptSkinning = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot.ExemptSkinning", true);
+        engineConfig.rewardScalingLoot = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot", true);
+        engineConfig.rewardScalingLootBOPAlwaysDropException = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot.BOPAlwaysDropException", true);
+        engineConfig.rewardScalingExemptContainers = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot.ExemptContainers", true);
+        engineConfig.rewardScalingExemptSkinning = sConfigMgr->GetOption<bool>("DungeonScale.RewardScaling.Loot.ExemptSkinning", true);
+
+        // Rescale
+        RescaleDeferDistant = sConfigMgr->GetOption<bool>("DungeonScale.Rescale.DeferDistant", true);
+        RescaleMaxPerTick = sConfigMgr->GetOption<uint32>("DungeonScale.Rescale.MaxPerTick", 25);
+
+        // Player Count
+        engineConfig.playerCountDecreaseDelay = sConfigMgr->GetOption<uint32>("DungeonScale.PlayerCount.DecreaseDelay", 5) * IN_MILLISECONDS;
+        engineConfig.playerCountIncreaseDelay = sConfigMgr->GetOption<uint32>("DungeonScale.PlayerCount.IncreaseDelay", 0) * IN_MILLISECONDS;
+
+        // Perf
+        if (sConfigMgr->GetOption<bool>("DungeonScale.Perf.Enable", true))
+            perfSampleInterval = std::max<uint32>(1, sConfigMgr->GetOption<uint32>("DungeonScale.Perf.SampleInterval", 64));
+        else
+            perfSampleInterval = 0;
+
+        // Metrics, the export thread is only restarted when its settings change
+        bool metricsEnable = sConfigMgr->GetOption<bool>("DungeonScale.Metrics.Enable", false);
+        std::string metricsFile = sConfigMgr->GetOption<std::string>("DungeonScale.Metrics.File", "dungeonscale.prom");
+        uint32 metricsInterval = std::max<uint32>(1, sConfigMgr->GetOption<uint32>("DungeonScale.Metrics.Interval", 15));
+
+        if (!metricsEnable)
+            StopMetricsExport();
+        else if (!MetricsExportRunning || metricsFile != MetricsFile || metricsInterval != MetricsInterval)
+            StartMetricsExport(metricsFile, metricsInterval);
+
+        MetricsExportRunning = metricsEnable;
+        MetricsFile = metricsFile;
+        MetricsInterval = metricsInterval;
+
+        // Recorder
+        RecorderEnable = sConfigMgr->GetOption<bool>("DungeonScale.Recorder.Enable", false);
+        RecorderRecords = std::max<uint32>(1, sConfigMgr->GetOption<uint32>("DungeonScale.Recorder.Records", 32768));
+        RecorderDirectory = sConfigMgr->GetOption<std::string>("DungeonScale.Recorder.Directory", "");
+
+        // Trace, a reload with the same file keeps appending to the running trace
+        bool traceEnable = sConfigMgr->GetOption<bool>("DungeonScale.Trace.Enable", false);
+        std::string traceFile = sConfigMgr->GetOption<std::string>("DungeonScale.Trace.File", "dungeonscale-trace.json");
+
+        if (!traceEnable)
+            StopTrace();
+        else if (!traceEnabled || traceFile != TraceFile)
+        {
+            StartTrace(traceFile);
+
+            if (!traceEnabled)
+                LOG_ERROR("module.DungeonScale", "DungeonScale::SetInitialWorldSettings: Could not open the trace file {}.", traceFile);
+        }
+
+        TraceFile = traceFile;
 
         // Announcement
         Announcement = sConfigMgr->GetOption<bool>("DungeonScaleAnnounce.enable", true);
@@ -3022,12 +3161,16 @@ class DungeonScale_PlayerScript : public PlayerScript
                 return;
             }
 
+            DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+            DUNGEONSCALE_PROBE3(map__reconfigure__start, map->GetId(), map->GetInstanceId(), mapDSInfo->adjustedPlayerCount);
+
             // update the map's player stats
             UpdateMapPlayerStats(map);
 
             // schedule all creatures for an update
-            DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+            SetRescaleTrigger(mapDSInfo, DUNGEONSCALE_RESCALE_TRIGGER_PLAYER_LEVEL);
             mapDSInfo->mapConfigTime = GetCurrentConfigTime();
+            StartRescaleWave(map, mapDSInfo);
         }
 
         void OnPlayerGiveXP(Player* player, uint32& amount, Unit* victim, uint8 /*xpSource*/) override
@@ -3042,33 +3185,36 @@ class DungeonScale_PlayerScript : public PlayerScript
 
             DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
 
-            if (victim && RewardScalingXP && mapDSInfo->enabled)
+            if (victim && mapDSInfo->rewardScalingXP)
             {
-                Map* map = player->GetMap();
+                DungeonScaleCreatureInfo const* creatureDSInfo = GetCreatureInfo(victim);
 
-                DungeonScaleCreatureInfo *creatureDSInfo=victim->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
-
-                if (map->IsDungeon())
+                if (RewardScalingMethod == DUNGEONSCALE_SCALING_DYNAMIC)
                 {
-                    if (RewardScalingMethod == DUNGEONSCALE_SCALING_DYNAMIC)
-                    {
-                        LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnGiveXP: Distributing XP from '{}' to '{}' in dynamic mode - {}->{}",
-                                 victim->GetName(), player->GetName(), amount, uint32(amount * creatureDSInfo->XPModifier));
-                        amount = uint32(amount * creatureDSInfo->XPModifier);
-                    }
-                    else if (RewardScalingMethod == DUNGEONSCALE_SCALING_FIXED)
-                    {
-                        // Ensure that the players always get the same XP, even when entering the dungeon alone
-                        auto maxPlayerCount = map->ToInstanceMap()->GetMaxPlayers();
-                        auto currentPlayerCount = mapDSInfo->playerCount;
-                        LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnGiveXP: Distributing XP from '{}' to '{}' in fixed mode - {}->{}",
-                                 victim->GetName(), player->GetName(), amount, uint32(amount * creatureDSInfo->XPModifier * ((float)currentPlayerCount / maxPlayerCount)));
-                        amount = uint32(amount * creatureDSInfo->XPModifier * ((float)currentPlayerCount / maxPlayerCount));
-                    }
+                    LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnGiveXP: Distributing XP from '{}' to '{}' in dynamic mode - {}->{}",
+                             victim->GetName(), player->GetName(), amount, uint32(amount * creatureDSInfo->XPModifier));
+                    amount = uint32(amount * creatureDSInfo->XPModifier);
+                }
+                else if (RewardScalingMethod == DUNGEONSCALE_SCALING_FIXED)
+                {
+                    // Ensure that the players always get the same XP, even when entering the dungeon alone
+                    LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnGiveXP: Distributing XP from '{}' to '{}' in fixed mode - {}->{}",
+                             victim->GetName(), player->GetName(), amount, uint32(amount * creatureDSInfo->XPModifier * mapDSInfo->rewardFixedXPRatio));
+                    amount = uint32(amount * creatureDSInfo->XPModifier * mapDSInfo->rewardFixedXPRatio);
                 }
             }
         }
 
+        void OnPlayerCreatureKill(Player* killer, Creature* killed) override
+        {
+            _RecordLootMoneyModifier(killer, killed);
+        }
+
+        void OnPlayerCreatureKilledByPet(Player* petOwner, Creature* killed) override
+        {
+            _RecordLootMoneyModifier(petOwner, killed);
+        }
+
         void OnPlayerBeforeLootMoney(Player* player, Loot* loot) override
         {
             Map* map = player->GetMap();
@@ -3080,40 +3226,46 @@ class DungeonScale_PlayerScript : public PlayerScript
             DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
             ObjectGuid sourceGuid = loot->sourceWorldObjectGUID;
 
-            if (mapDSInfo->enabled && RewardScalingMoney)
+            if (mapDSInfo->rewardScalingMoney)
             {
                 // if the loot source is a creature, honor the modifiers for that creature
                 if (sourceGuid.IsCreature())
                 {
-                    Creature* sourceCreature = ObjectAccessor::GetCreature(*player, sourceGuid);
-                    DungeonScaleCreatureInfo *creatureDSInfo=sourceCreature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+                    // the modifier was recorded when the creature was killed, only look up the creature if that was missed
+                    float moneyModifier = 1.0f;
+                    auto recordedModifier = mapDSInfo->lootMoneyModifiers.find(sourceGuid);
+                    if (recordedModifier != mapDSInfo->lootMoneyModifiers.end())
+                    {
+                        moneyModifier = recordedModifier->second;
+                        mapDSInfo->lootMoneyModifiers.erase(recordedModifier);
+                    }
+                    else if (Creature* sourceCreature = ObjectAccessor::GetCreature(*player, sourceGuid))
+                    {
+                        moneyModifier = GetCreatureInfo(sourceCreature)->MoneyModifier;
+                    }
 
                     // Dynamic Mode
                     if (RewardScalingMethod == DUNGEONSCALE_SCALING_DYNAMIC)
                     {
                         LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnBeforeLootMoney: Distributing money from '{}' in dynamic mode - {}->{}",
-                                 sourceCreature->GetName(), loot->gold, uint32(loot->gold * creatureDSInfo->MoneyModifier));
-                        loot->gold = uint32(loot->gold * creatureDSInfo->MoneyModifier);
+                                 sourceGuid.ToString(), loot->gold, uint32(loot->gold * moneyModifier));
+                        loot->gold = uint32(loot->gold * moneyModifier);
                     }
                     // Fixed Mode
                     else if (RewardScalingMethod == DUNGEONSCALE_SCALING_FIXED)
                     {
                         // Ensure that the players always get the same money, even when entering the dungeon alone
-                        auto maxPlayerCount = map->ToInstanceMap()->GetMaxPlayers();
-                        auto currentPlayerCount = mapDSInfo->adjustedPlayerCount;
                         LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnBeforeLootMoney: Distributing money from '{}' in fixed mode - {}->{}",
-                                 sourceCreature->GetName(), loot->gold, uint32(loot->gold * creatureDSInfo->MoneyModifier * ((float)currentPlayerCount / maxPlayerCount)));
-                        loot->gold = uint32(loot->gold * creatureDSInfo->MoneyModifier * ((float)currentPlayerCount / maxPlayerCount));
+                                 sourceGuid.ToString(), loot->gold, uint32(loot->gold * moneyModifier * mapDSInfo->rewardFixedMoneyRatio));
+                        loot->gold = uint32(loot->gold * moneyModifier * mapDSInfo->rewardFixedMoneyRatio);
                     }
                 }
                 // for all other loot sources, just distribute in Fixed mode as though the instance was full
                 else
                 {
-                    auto maxPlayerCount = map->ToInstanceMap()->GetMaxPlayers();
-                    auto currentPlayerCount = mapDSInfo->adjustedPlayerCount;
                     LOG_DEBUG("module.DungeonScale", "DungeonScale_PlayerScript::OnBeforeLootMoney: Distributing money from a non-creature in fixed mode - {}->{}",
-                             loot->gold, uint32(loot->gold * ((float)currentPlayerCount / maxPlayerCount)));
-                    loot->gold = uint32(loot->gold * ((float)currentPlayerCount / maxPlayerCount));
+                             loot->gold, uint32(loot->gold * mapDSInfo->rewardFixedMoneyRatio));
+                    loot->gold = uint32(loot->gold * mapDSInfo->rewardFixedMoneyRatio);
                 }
             }
         }
@@ -3237,6 +3389,7 @@ class DungeonScale_PlayerScript : public PlayerScript
                 if (mapDSInfo->combatLockTripped && mapDSInfo->playerCount != mapDSInfo->combatLockMinPlayers)
                 {
                     mapDSInfo->mapConfigTime = 1;
+                    SetRescaleTrigger(mapDSInfo, DUNGEONSCALE_RESCALE_TRIGGER_COMBAT_LOCK_LIFTED);
                     LOG_DEBUG("module.DungeonScale_CombatLocking", "DungeonScale_PlayerScript::OnPlayerLeaveCombat: Map {} ({}{}) | Reset map config time to ({}).",
                                 map->GetMapName(),
                                 map->GetId(),
@@ -3248,6 +3401,32 @@ class DungeonScale_PlayerScript : public PlayerScript
                 }
             }
         }
+
+    private:
+        // remember the victim's money modifier against its GUID so the loot hook doesn't have to find the creature again
+        void _RecordLootMoneyModifier(Player* player, Creature* killed)
+        {
+            if (!player || !killed)
+            {
+                return;
+            }
+
+            Map* map = killed->GetMap();
+
+            if (!map || !map->IsDungeon() || !map->GetInstanceId())
+            {
+                return;
+            }
+
+            DungeonScaleMapInfo *mapDSInfo=map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+
+            if (!mapDSInfo->rewardScalingMoney)
+            {
+                return;
+            }
+
+            mapDSInfo->lootMoneyModifiers[killed->GetGUID()] = GetCreatureInfo(killed)->MoneyModifier;
+        }
 };
 
 class DungeonScale_UnitScript : public UnitScript
@@ -3260,6 +3439,8 @@ class DungeonScale_UnitScript : public UnitScript
 
         void ModifyPeriodicDamageAurasTick(Unit* target, Unit* source, uint32& amount, SpellInfo const* spellInfo) override
         {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_MODIFY_PERIODIC_DAMAGE_AURAS_TICK);
+
             // if the spell is negative (damage), we need to flip the sign
             // if the spell is positive (healing or other) we keep it the same
             int32 adjustedAmount = !spellInfo->IsPositive() ? amount * -1 : amount;
@@ -3280,6 +3461,8 @@ class DungeonScale_UnitScript : public UnitScript
 
         void ModifySpellDamageTaken(Unit* target, Unit* source, int32& amount, SpellInfo const* spellInfo) override
         {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_MODIFY_SPELL_DAMAGE_TAKEN);
+
             // if the spell is negative (damage), we need to flip the sign to negative
             // if the spell is positive (healing or other) we keep it the same (positive)
             int32 adjustedAmount = !spellInfo->IsPositive() ? amount * -1 : amount;
@@ -3300,6 +3483,8 @@ class DungeonScale_UnitScript : public UnitScript
 
         void ModifyMeleeDamage(Unit* target, Unit* source, uint32& amount) override
         {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_MODIFY_MELEE_DAMAGE);
+
             // melee damage is always negative, so we need to flip the sign to negative
             int32 adjustedAmount = amount * -1;
 
@@ -3318,6 +3503,8 @@ class DungeonScale_UnitScript : public UnitScript
 
         void ModifyHealReceived(Unit* target, Unit* source, uint32& amount, SpellInfo const* spellInfo) override
         {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_MODIFY_HEAL_RECEIVED);
+
             // healing is always positive, no need for any sign flip
 
             // only debug if the source or target is a player
@@ -3332,6 +3519,8 @@ class DungeonScale_UnitScript : public UnitScript
         }
 
         void OnAuraApply(Unit* unit, Aura* aura) override {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_ON_AURA_APPLY);
+
             // only debug if the source or target is a player
             bool _debug_damage_and_healing = (unit && unit->GetTypeId() == TYPEID_PLAYER);
             _debug_damage_and_healing = (unit && unit->GetMap()->GetInstanceId());
@@ -3422,243 +3611,95 @@ class DungeonScale_UnitScript : public UnitScript
             {
                 LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::{}: {}: W? T? F? with {}{}",
                     function_name,
-                    phase ? "AFTER" : "BEFORE",
-                    spell_name,
-                    spell_id ? " (" + std::to_string(spell_id) + ")" : ""
-                );
-            }
-        }
-
-        int32 _Modify_Damage_Healing(Unit* target, Unit* source, int32 amount, SpellInfo const* spellInfo = nullptr)
-        {
-            //
-            // Pre-flight Checks
-            //
-
-            // only debug if the source or target is a player
-            bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
-            _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
-
-            // check that we're enabled globally, else return the original value
-            if (!EnableGlobal)
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: EnableGlobal is false, returning original value of ({}).", amount);
-
-                return amount;
-            }
-
-            // if the source is gone (logged off? despawned?), use the same target and source.
-            // hacky, but better than crashing or having the damage go to 1.0x
-            if (!source)
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is null, using target as source.");
-
-                source = target;
-            }
-
-            // make sure the source and target are in an instance, else return the original damage
-            if (!(source->GetMap()->IsDungeon() && target->GetMap()->IsDungeon()))
-            {
-                //if (_debug_damage_and_healing)
-                //    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Not in an instance, returning original value of ({}).", amount);
-
-                return amount;
-            }
-
-            // make sure that the source is in the world, else return the original value
-            if (!source->IsInWorld())
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source does not exist in the world, returning original value of ({}).", amount);
-
-                return amount;
-            }
-
-            // if the spell ID is in our "never modify" list, return the original value
-            if
-            (
-                spellInfo &&
-                spellInfo->Id &&
-                std::find
-                (
-                    spellIdsToNeverModify.begin(),
-                    spellIdsToNeverModify.end(),
-                    spellInfo->Id
-                ) != spellIdsToNeverModify.end()
-            )
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Spell {}({}) is in the never modify list, returning original value of ({}).",
-                        spellInfo->SpellName[0],
-                        spellInfo->Id,
-                        amount
-                    );
-
-                return amount;
-            }
-
-            // Any healing on a player should not be scaled
-            if (amount >= 0 && target->GetTypeId() == TYPEID_PLAYER)
-            {
-                return amount;
-            }
-
-            // get the maps' info
-            DungeonScaleMapInfo *sourceMapDSInfo = source->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
-            DungeonScaleMapInfo *targetMapDSInfo = target->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
-
-            // if either the target or the source's maps are not enabled, return the original damage
-            if (!sourceMapDSInfo->enabled || !targetMapDSInfo->enabled)
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source or Target's map is not enabled, returning original value of ({}).", amount);
-
-                return amount;
-            }
-
-            //
-            // Source and Target Checking
-            //
-
-            // if the source is a player and they are healing themselves, return the original value
-            if (source->GetTypeId() == TYPEID_PLAYER && source->GetGUID() == target->GetGUID() && amount >= 0)
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a player that is self-healing, returning original value of ({}).", amount);
-
-                return amount;
-            }
-            // if the source is a player and they are damaging themselves, log to debug but continue
-            else if (source->GetTypeId() == TYPEID_PLAYER && source->GetGUID() == target->GetGUID() && amount < 0)
-            {
-                // if the spell used is in our list of spells to ignore, return the original value
-                if
-                (
-                    spellInfo &&
-                    spellInfo->Id &&
-                    std::find
-                    (
-                        spellIdsThatSpendPlayerHealth.begin(),
-                        spellIdsThatSpendPlayerHealth.end(),
-                        spellInfo->Id
-                    ) != spellIdsThatSpendPlayerHealth.end()
-                )
-                {
-                    if (_debug_damage_and_healing)
-                        LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a player that is self-damaging with a spell that is ignored, returning original value of ({}).", amount);
-
-                    return amount;
-                }
-
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a player that is self-damaging, continuing.");
-            }
-            // if the source is a player and they are damaging unit that is friendly, log to debug but continue
-            else if (source->GetTypeId() == TYPEID_PLAYER && target->IsFriendlyTo(source) && amount < 0)
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a player that is damaging a friendly unit, continuing.");
-            }
-            // if the source is a player under any other condition, return the original value
-            else if (source->GetTypeId() == TYPEID_PLAYER)
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is an enemy player, returning original value of ({}).", amount);
-
-                return amount;
-            }
-            // if the creature is attacking itself with an aura with effect type SPELL_AURA_SHARE_DAMAGE_PCT, return the orginal damage
-            else if
-            (
-                source->GetTypeId() == TYPEID_UNIT &&
-                source->GetTypeId() != TYPEID_PLAYER &&
-                source->GetGUID() == target->GetGUID() &&
-                _isAuraWithEffectType(spellInfo, SPELL_AURA_SHARE_DAMAGE_PCT)
-            )
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a creature that is self-damaging with an aura that shares damage, returning original value of ({}).", amount);
-
-                return amount;
+                    phase ? "AFTER" : "BEFORE",
+                    spell_name,
+                    spell_id ? " (" + std::to_string(spell_id) + ")" : ""
+                );
             }
+        }
 
-            // if the source is under the control of the player, return the original damage
-            // noteably, this should NOT include mind control targets
-            if ((source->IsHunterPet() || source->IsPet() || source->IsSummon()) && source->IsControlledByPlayer())
-            {
-                if (_debug_damage_and_healing)
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a player-controlled pet or summon, returning original value of ({}).", amount);
+        // what the shared damage/healing hook body (ModifyDamageHealing in DungeonScaleEngine.h) needs to know about units, spells and maps
+        class DamageHealingUnits
+        {
+        public:
+            DamageHealingUnits(DungeonScale_UnitScript* script, bool isDebug) : script(script), isDebug(isDebug) { }
 
-                return amount;
-            }
+            bool IsEnabled() const { return EnableGlobal; }
+            bool IsDungeon(Unit* unit) const { return unit->GetMap()->IsDungeon(); }
+            bool IsInWorld(Unit* unit) const { return unit->IsInWorld(); }
+            bool IsPlayer(Unit* unit) const { return unit->GetTypeId() == TYPEID_PLAYER; }
+            bool IsCreature(Unit* unit) const { return unit->GetTypeId() == TYPEID_UNIT; }
+            bool IsSameUnit(Unit* unit, Unit* other) const { return unit->GetGUID() == other->GetGUID(); }
+            bool IsFriendlyTo(Unit* target, Unit* source) const { return target->IsFriendlyTo(source); }
+            bool IsShareDamageAura(SpellInfo const* spellInfo) const { return script->_isAuraWithEffectType(spellInfo, SPELL_AURA_SHARE_DAMAGE_PCT); }
+            uint32 GetSpellId(SpellInfo const* spellInfo) const { return spellInfo ? spellInfo->Id : 0; }
+            DungeonScaleMapInfo* GetMapInfo(Unit* unit) const { return unit->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo"); }
+            float GetDamageMultiplier(Unit* unit) const { return GetCreatureInfo(unit)->DamageMultiplier; }
 
-            //
-            // Multiplier calculation
-            //
-            float damageMultiplier = 1.0f;
+            // noteably, this should NOT include mind control targets
+            bool IsPlayerControlled(Unit* unit) const { return (unit->IsHunterPet() || unit->IsPet() || unit->IsSummon()) && unit->IsControlledByPlayer(); }
 
-            // if the source is a player AND the target is that same player AND the value is damage (negative), use the map's multiplier
-            if (source->GetTypeId() == TYPEID_PLAYER && source->GetGUID() == target->GetGUID() && amount < 0)
+            void OnEarlyOut(char const* reason, int32 amount) const
             {
-                damageMultiplier = sourceMapDSInfo->worldDamageHealingMultiplier;
-                if (_debug_damage_and_healing)
-                {
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC",
-                            "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is a player and the target is that same player, using the map's (level-scaling ignored) multiplier: ({})",
-                            damageMultiplier
-                    );
-                }
+                if (isDebug)
+                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: {}, returning original value of ({}).", reason, amount);
             }
-            // if the target is a player AND the value is healing (positive), use the map's damage multiplier
-            // (player to player healing was already eliminated in the Source and Target Checking section)
-            else if (target->GetTypeId() == TYPEID_PLAYER && amount >= 0)
+
+            void OnSourceMissing() const
             {
-                damageMultiplier = targetMapDSInfo->worldDamageHealingMultiplier;
-                if (_debug_damage_and_healing)
-                {
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC",
-                              "DungeonScale_UnitScript::_Modify_Damage_Healing: A non-player is healing a player, using the map's multiplier: ({})",
-                              damageMultiplier
-                    );
-                }
+                if (isDebug)
+                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Source is null, using target as source.");
             }
-            // if the target is a player AND the source is not a creature, use the map's multiplier
-            else if (target->GetTypeId() == TYPEID_PLAYER && source->GetTypeId() != TYPEID_UNIT && amount < 0)
+
+            void OnStart(Unit* source, uint32 spellId, int32 amount) const
             {
-                damageMultiplier = targetMapDSInfo->worldDamageHealingMultiplier;
-                if (_debug_damage_and_healing)
-                {
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC",
-                            "DungeonScale_UnitScript::_Modify_Damage_Healing: Target is a player and the source is not a creature, using the map's (level-scaling-ignored) multiplier: ({})",
-                            damageMultiplier
-                    );
-                }
+                DUNGEONSCALE_PROBE4(damage__modify__start, source->GetMapId(), source->GetEntry(), spellId, amount);
             }
-            // otherwise, use the source creature's damage multiplier
-            else
+
+            void OnDecided(Unit* source, DungeonScaleMapInfo* sourceMapDSInfo, DungeonScaleDamageHealingEvent const& event, DungeonScaleDamageHealingBranch branch, float multiplier, int32 result) const
             {
-                damageMultiplier = source->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo")->DamageMultiplier;
-                if (_debug_damage_and_healing)
+                // healing on a player is decided before the maps' info is looked up, there is nothing to record it with
+                if (!sourceMapDSInfo)
                 {
-                    LOG_DEBUG("module.DungeonScale_DamageHealingCC",
-                            "DungeonScale_UnitScript::_Modify_Damage_Healing: Using the source creature's damage multiplier: ({})",
-                            damageMultiplier
-                    );
+                    DUNGEONSCALE_PROBE7(damage__modify, source->GetMapId(), source->GetEntry(), event.spellId, branch, event.amount, GetProbeMultiplier(multiplier), result);
+                    return;
                 }
+
+                RecordDamageHealing(source, sourceMapDSInfo, event, branch, multiplier, result);
+
+                if (!isDebug)
+                    return;
+
+                if (branch < DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_DAMAGE)
+                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: {}, returning original value of ({}).",
+                        GetDamageHealingBranchName(branch),
+                        event.amount
+                    );
+                else
+                    LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: {}: ({}). Returning modified {}: ({}) * ({}) = ({})",
+                        GetDamageHealingBranchName(branch),
+                        multiplier,
+                        event.amount <= 0 ? "damage" : "healing",
+                        event.amount,
+                        multiplier,
+                        result
+                    );
             }
 
-            // we are good to go, return the original damage times the multiplier
-            if (_debug_damage_and_healing)
-                LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Returning modified {}: ({}) * ({}) = ({})",
-                    amount <= 0 ? "damage" : "healing",
-                    amount,
-                    damageMultiplier,
-                    amount * damageMultiplier
-                );
+        private:
+            DungeonScale_UnitScript* script;
+            bool isDebug;
+        };
+
+        int32 _Modify_Damage_Healing(Unit* target, Unit* source, int32 amount, SpellInfo const* spellInfo = nullptr)
+        {
+            // only debug if the source or target is a player
+            bool _debug_damage_and_healing = ((source && (source->GetTypeId() == TYPEID_PLAYER || source->IsControlledByPlayer())) || (target && target->GetTypeId() == TYPEID_PLAYER));
+            _debug_damage_and_healing = (source && source->GetMap()->GetInstanceId());
 
-            return amount * damageMultiplier;
+            // the early-outs, the engine's decision and the multiplier are shared with tools/DungeonScaleDamageStress.cpp
+            DamageHealingUnits units(this, _debug_damage_and_healing);
+            return ModifyDamageHealing(units, target, source, amount, spellInfo);
         }
 
         uint32 _Modifier_CCDuration(Unit* target, Unit* caster, Aura* aura)
@@ -3674,6 +3715,8 @@ class DungeonScale_UnitScript : public UnitScript
             if (!target || !caster)
                 return originalDuration;
 
+            DUNGEONSCALE_PROBE4(aura__cc__duration__start, caster->GetMapId(), caster->GetEntry(), aura->GetSpellInfo()->Id, (int32)originalDuration);
+
             // if the aura wasn't cast just now, don't change it
             if (aura->GetDuration() != aura->GetMaxDuration())
                 return originalDuration;
@@ -3687,7 +3730,7 @@ class DungeonScale_UnitScript : public UnitScript
                 return originalDuration;
 
             // get the current creature's CC duration multiplier
-            float ccDurationMultiplier = caster->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo")->CCDurationMultiplier;
+            float ccDurationMultiplier = GetCreatureInfo(caster)->CCDurationMultiplier;
 
             // if it's the default of 1.0, return the original damage
             if (ccDurationMultiplier == 1)
@@ -3710,6 +3753,15 @@ class DungeonScale_UnitScript : public UnitScript
                 aura->HasEffectType(SPELL_AURA_MOD_SPEED_SLOW_ALL)
                 )
             {
+                DUNGEONSCALE_PROBE6(aura__cc__duration,
+                    caster->GetMapId(),
+                    caster->GetEntry(),
+                    aura->GetSpellInfo()->Id,
+                    (int32)originalDuration,
+                    GetProbeMultiplier(ccDurationMultiplier),
+                    (int32)(originalDuration * ccDurationMultiplier)
+                );
+
                 return originalDuration * ccDurationMultiplier;
             }
             else
@@ -3873,17 +3925,7 @@ class DungeonScale_GameObjectScript : public AllGameObjectScript
             }
 
             // if the spell ID is in our "never modify" list, return the original value
-            if
-            (
-                spellInfo &&
-                spellInfo->Id &&
-                std::find
-                (
-                    spellIdsToNeverModify.begin(),
-                    spellIdsToNeverModify.end(),
-                    spellInfo->Id
-                ) != spellIdsToNeverModify.end()
-            )
+            if (spellInfo && IsSpellNeverModified(spellInfo->Id))
             {
                 if (_debug_damage_and_healing)
                     LOG_DEBUG("module.DungeonScale_DamageHealingCC", "DungeonScale_UnitScript::_Modify_Damage_Healing: Spell {}({}) is in the never modify list, returning original value of ({}).",
@@ -3946,6 +3988,8 @@ class DungeonScale_AllMapScript : public AllMapScript
 
         void OnCreateMap(Map* map)
         {
+            DungeonScaleTraceScope traceScope("OnCreateMap", map->GetId(), map->GetInstanceId());
+
             LOG_DEBUG("module.DungeonScale", "DungeonScale_AllMapScript::OnCreateMap(): Map {} ({}{})",
                 map->GetMapName(),
                 map->GetId(),
@@ -3960,50 +4004,35 @@ class DungeonScale_AllMapScript : public AllMapScript
             if (map->IsDungeon())
             {
                 // get the map's LFG stats even if not enabled
-                LFGDungeonEntry const* dungeon = GetLFGDungeon(map->GetId(), map->GetDifficulty());
-                if (dungeon) {
-                    mapDSInfo->lfgMinLevel = dungeon->MinLevel;
-                    mapDSInfo->lfgMaxLevel = dungeon->MaxLevel;
-                    mapDSInfo->lfgTargetLevel = dungeon->TargetLevel;
-                }
-                // if this is a heroic dungeon that isn't in LFG, get the stats from the non-heroic version
-                else if (map->IsHeroic())
+                auto lfgLevelsIterator = lfgLevelsByMapDifficulty.find((map->GetId() << 8) | map->GetDifficulty());
+                if (lfgLevelsIterator != lfgLevelsByMapDifficulty.end())
                 {
-                    LFGDungeonEntry const* nonHeroicDungeon = nullptr;
-                    if (map->GetDifficulty() == DUNGEON_DIFFICULTY_HEROIC)
-                    {
-                        nonHeroicDungeon = GetLFGDungeon(map->GetId(), DUNGEON_DIFFICULTY_NORMAL);
-                    }
-                    else if (map->GetDifficulty() == RAID_DIFFICULTY_10MAN_HEROIC)
-                    {
-                        nonHeroicDungeon = GetLFGDungeon(map->GetId(), RAID_DIFFICULTY_10MAN_NORMAL);
-                    }
-                    else if (map->GetDifficulty() == RAID_DIFFICULTY_25MAN_HEROIC)
-                    {
-                        nonHeroicDungeon = GetLFGDungeon(map->GetId(), RAID_DIFFICULTY_25MAN_NORMAL);
-                    }
+                    DungeonScaleLFGLevels const& lfgLevels = lfgLevelsIterator->second;
 
-                    LOG_DEBUG("module.DungeonScale", "DungeonScale_AllMapScript::OnCreateMap(): Map {} ({}{}) | is a Heroic dungeon that is not in LFG. Using non-heroic LFG levels.",
-                        map->GetMapName(),
-                        map->GetId(),
-                        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
-                    );
+                    mapDSInfo->lfgMinLevel = lfgLevels.minLevel;
+                    mapDSInfo->lfgMaxLevel = lfgLevels.maxLevel;
+                    mapDSInfo->lfgTargetLevel = lfgLevels.targetLevel;
+                    mapDSInfo->lfgMinLevelBound = lfgLevels.minLevelBound;
+                    mapDSInfo->lfgMaxLevelBound = lfgLevels.maxLevelBound;
 
-                    if (nonHeroicDungeon)
-                    {
-                        mapDSInfo->lfgMinLevel = nonHeroicDungeon->MinLevel;
-                        mapDSInfo->lfgMaxLevel = nonHeroicDungeon->MaxLevel;
-                        mapDSInfo->lfgTargetLevel = nonHeroicDungeon->TargetLevel;
-                    }
-                    else
+                    // if this is a heroic dungeon that isn't in LFG, the stats come from the non-heroic version
+                    if (lfgLevels.isFromNormalDifficulty)
                     {
-                        LOG_ERROR("module.DungeonScale", "DungeonScale_AllMapScript::OnCreateMap(): Map {} ({}{}) | Could not determine LFG level ranges for this map. Level will bet set to 0.",
+                        LOG_DEBUG("module.DungeonScale", "DungeonScale_AllMapScript::OnCreateMap(): Map {} ({}{}) | is a Heroic dungeon that is not in LFG. Using non-heroic LFG levels.",
                             map->GetMapName(),
                             map->GetId(),
                             map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
                         );
                     }
                 }
+                else if (map->IsHeroic())
+                {
+                    LOG_ERROR("module.DungeonScale", "DungeonScale_AllMapScript::OnCreateMap(): Map {} ({}{}) | Could not determine LFG level ranges for this map. Level will bet set to 0.",
+                        map->GetMapName(),
+                        map->GetId(),
+                        map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
+                    );
+                }
 
                 if (map->GetInstanceId())
                 {
@@ -4012,6 +4041,10 @@ class DungeonScale_AllMapScript : public AllMapScript
                         map->GetId(),
                         map->GetInstanceId() ? "-" + std::to_string(map->GetInstanceId()) : ""
                     );
+
+                    if (RecorderEnable)
+                        mapDSInfo->recorder = std::make_unique<DungeonScaleRecorder>(RecorderRecords, GetSteadyTimeMS(), GameTime::GetGameTime().count());
+
                     UpdateMapDataIfNeeded(map);
 
                     // provide a concise summary of the map data we collected
@@ -4036,9 +4069,58 @@ class DungeonScale_AllMapScript : public AllMapScript
             }
         }
 
+        void OnMapUpdate(Map* map, uint32 /*diff*/) override
+        {
+            if (!map->IsDungeon() || !map->GetInstanceId())
+                return;
+
+            // the gauges are only kept up to date while they are exported, once the export stops each map takes its contribution back out
+            bool retract = !MetricsExportRunning;
+            if (retract && !MetricsPublishedMaps.load(std::memory_order_relaxed))
+                return;
+
+            PublishMapMetrics(map, map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo"), retract);
+        }
+
+        void OnDestroyMap(Map* map) override
+        {
+            if (!map->IsDungeon() || !map->GetInstanceId())
+                return;
+
+            DungeonScaleMapInfo* mapDSInfo = map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+
+            // take the instance back out of the metrics gauges
+            PublishMapMetrics(map, mapDSInfo, true);
+
+            // the last wave is only traced once it is over
+            TraceRescaleWave(map, mapDSInfo);
+
+            // keep what the instance recorded
+            if (mapDSInfo->recorder && mapDSInfo->recorder->GetRecordCount())
+            {
+                std::string recordingPath = SaveMapRecording(map, mapDSInfo);
+                if (!recordingPath.empty())
+                    LOG_INFO("module.DungeonScale", "DungeonScale_AllMapScript::OnDestroyMap(): Map {} ({}-{}) | {} event(s) recorded to {}.",
+                        map->GetMapName(),
+                        map->GetId(),
+                        map->GetInstanceId(),
+                        mapDSInfo->recorder->GetRecordCount(),
+                        recordingPath
+                    );
+            }
+
+            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllMapScript::OnDestroyMap(): Map {} ({}-{}) | is unloaded.",
+                map->GetMapName(),
+                map->GetId(),
+                map->GetInstanceId()
+            );
+        }
+
         // hook triggers after the player has already entered the world
         void OnPlayerEnterAll(Map* map, Player* player)
         {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_ON_PLAYER_ENTER_ALL);
+
             if (!EnableGlobal)
                 return;
 
@@ -4092,9 +4174,13 @@ class DungeonScale_AllMapScript : public AllMapScript
             }
 
             // see which existing creatures are active
-            for (std::vector<Creature*>::iterator creatureIterator = mapDSInfo->allMapCreatures.begin(); creatureIterator != mapDSInfo->allMapCreatures.end(); ++creatureIterator)
             {
-                AddCreatureToMapCreatureList(*creatureIterator, false, true);
+                DungeonScaleTraceScope traceScope("OnPlayerEnterAll creature re-walk", map->GetId(), map->GetInstanceId());
+
+                for (std::vector<Creature*>::iterator creatureIterator = mapDSInfo->allMapCreatures.begin(); creatureIterator != mapDSInfo->allMapCreatures.end(); ++creatureIterator)
+                {
+                    AddCreatureToMapCreatureList(*creatureIterator, false, true);
+                }
             }
 
             // Notify players of the change
@@ -4149,6 +4235,8 @@ class DungeonScale_AllMapScript : public AllMapScript
         // hook triggers just before the player left the world
         void OnPlayerLeaveAll(Map* map, Player* player)
         {
+            DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_ON_PLAYER_LEAVE_ALL);
+
             if (!EnableGlobal)
                 return;
 
@@ -4221,6 +4309,7 @@ class DungeonScale_AllMapScript : public AllMapScript
             {
                 {
                     mapDSInfo->playerCount = mapDSInfo->allMapPlayers.size();
+                    UpdateMapRewardProfile(map);
                     LOG_DEBUG("module.DungeonScale", "DungeonScale_AllMapScript::OnPlayerLeaveAll: Player {} left the instance.",
                         player->GetName(),
                         mapDSInfo->playerCount,
@@ -4288,6 +4377,12 @@ public:
                         creature->GetSpawnId()
             );
 
+            // creatures that were already found not to be relevant keep their original level
+            if (isCreatureInfoReleased(creature))
+            {
+                return;
+            }
+
             // Create the new creature's DS info
             DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
 
@@ -4310,6 +4405,14 @@ public:
             // Update the map's data if it is out of date (just before changing the map's creature list)
             UpdateMapDataIfNeeded(creature->GetMap());
 
+            // summons identical to an earlier one (same entry, summoner and spawn level) skip straight to their level
+            uint8 spawnLevel = level;
+            if (_applySummonProfile(creature, creatureDSInfo, spawnLevel))
+            {
+                level = creatureDSInfo->selectedLevel;
+                return;
+            }
+
             Map* creatureMap = creature->GetMap();
             InstanceMap* instanceMap = creatureMap->ToInstanceMap();
 
@@ -4337,6 +4440,9 @@ public:
 
             if (isCreatureRelevant(creature))
             {
+                // remember how this summon was resolved for the next identical one
+                _recordSummonProfile(creature, creatureDSInfo, spawnLevel);
+
             // set the new creature level
                 level = creatureDSInfo->selectedLevel;
 
@@ -4371,6 +4477,12 @@ public:
             return;
         }
 
+        // creatures that were already found not to be relevant need no processing
+        if (isCreatureInfoReleased(creature))
+        {
+            return;
+        }
+
         // get the creature's info
         DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
 
@@ -4420,11 +4532,12 @@ public:
         {
             Map* creatureMap = creature->GetMap();
             InstanceMap* instanceMap = creatureMap->ToInstanceMap();
-            DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
 
             // final checks on the creature before spawning
             if (isCreatureRelevant(creature))
             {
+                DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+
                 // max health check
                 if (creature->GetMaxHealth() != creatureDSInfo->initialMaxHealth)
                 {
@@ -4452,6 +4565,9 @@ public:
                         instanceMap ? ", " + std::to_string(instanceMap->GetMaxPlayers()) + "-player" : "",
                         instanceMap ? instanceMap->IsHeroic() ? " Heroic" : " Normal" : ""
             );
+
+            // the creature won't be scaled, so it doesn't need to keep a full record
+            ReleaseCreatureInfoIfNotRelevant(creature);
         }
     }
 
@@ -4489,6 +4605,8 @@ public:
 
     void OnAllCreatureUpdate(Creature* creature, uint32 /*diff*/) override
     {
+        DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_ON_ALL_CREATURE_UPDATE);
+
         // ensure we're in a dungeon with a creature
         if (
             !creature ||
@@ -4500,12 +4618,21 @@ public:
             return;
         }
 
+        // nobody is in the map to notice, the work is done lazily once a player enters again
+        DungeonScaleMapInfo const* mapDSInfo = creature->GetMap()->CustomData.Get<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+        if (mapDSInfo && mapDSInfo->isDormant)
+        {
+            return;
+        }
+
         // update map data before making creature changes
         UpdateMapDataIfNeeded(creature->GetMap());
 
         // If the config is out of date and the creature was reset, run modify against it
         if (ResetCreatureIfNeeded(creature))
         {
+            std::chrono::steady_clock::time_point rescaleStart = std::chrono::steady_clock::now();
+
             LOG_DEBUG("module.DungeonScale", "DungeonScale:: {}", SPACER);
 
             LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::OnAllCreatureUpdate: Creature {} ({}) | Entry ID: ({}) | Spawn ID: ({})",
@@ -4520,7 +4647,19 @@ public:
 
             ModifyCreatureAttributes(creature);
 
+            // if no scaled stats were written, the creature goes back to its original stats
             DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+            bool restoredToBaseStats = creatureDSInfo->isAwaitingScaledStats;
+            if (restoredToBaseStats)
+            {
+                RestoreCreatureBaseStats(creature);
+            }
+
+            RecordCreatureRescale(
+                creature->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo"),
+                restoredToBaseStats,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - rescaleStart).count()
+            );
         }
     }
 
@@ -4550,11 +4689,19 @@ public:
             LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::ResetCreatureIfNeeded: Creature {} ({}) | is dead and mapConfigTime is not 0 - prime for reset if revived.", creature->GetName(), creature->GetLevel());
             creatureDSInfo->mapConfigTime = 1;
             creatureDSInfo->wasAliveNowDead = true;
+
+            // it died before a player got near enough to need its new scaling
+            if (creatureDSInfo->isRescaleDeferred)
+            {
+                creatureDSInfo->isRescaleDeferred = false;
+                mapDSInfo->rescalesAvoided++;
+            }
+
             return false;
         }
 
-        // if the config is outdated, reset the creature
-        if (creatureDSInfo->mapConfigTime < mapDSInfo->mapConfigTime)
+        // if the config is outdated, reset the creature (once its turn in the rescale order comes up)
+        if (creatureDSInfo->mapConfigTime < mapDSInfo->mapConfigTime && IsCreatureRescaleDue(creature, creatureDSInfo, mapDSInfo))
         {
             LOG_DEBUG("module.DungeonScale", "DungeonScale:: {}", SPACER);
 
@@ -4572,62 +4719,61 @@ public:
                         mapDSInfo->mapConfigTime
             );
 
-            // retain some values
-            uint8 unmodifiedLevel = creatureDSInfo->UnmodifiedLevel;
-            bool isActive = creatureDSInfo->isActive;
-            bool wasAliveNowDead = creatureDSInfo->wasAliveNowDead;
-            bool isInCreatureList = creatureDSInfo->isInCreatureList;
-
-            // reset DungeonScale modifiers
-            creature->CustomData.Erase("DungeonScaleCreatureInfo");
-            DungeonScaleCreatureInfo *creatureDSInfo = creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+            // reset DungeonScale modifiers in place, retaining the original level, active, dead and creature list states
+            // the stats themselves are left alone, ModifyCreatureAttributes writes the new values over the old ones directly
+            creatureDSInfo->ResetScaling();
+            creatureDSInfo->isAwaitingScaledStats = true;
+            mapDSInfo->rescalesPerformed++;
+            AddPerfGauge(DUNGEONSCALE_PERF_GAUGE_RESCALES, 1);
 
-            // grab the creature's template and the original creature's stats
-            CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate();
-
-            // get the creature's base stats
-            CreatureBaseStats const* origCreatureBaseStats = sObjectMgr->GetCreatureBaseStats(unmodifiedLevel, creatureTemplate->unit_class);
+            // return true to indicate that the creature was reset
+            return true;
+        }
 
-            // health
-            float currentHealthPercent = (float)creature->GetHealth() / (float)creature->GetMaxHealth();
-            creature->SetMaxHealth(origCreatureBaseStats->GenerateHealth(creatureTemplate));
-            creature->SetHealth((float)origCreatureBaseStats->GenerateHealth(creatureTemplate) * currentHealthPercent);
+        // creature was not reset, return false
+        return false;
 
-            // mana
-            if (creature->getPowerType() == POWER_MANA && creature->GetPower(POWER_MANA) >= 0 && creature->GetMaxPower(POWER_MANA) > 0)
-            {
-                float currentManaPercent = creature->GetPower(POWER_MANA) / creature->GetMaxPower(POWER_MANA);
-                creature->SetMaxPower(POWER_MANA, origCreatureBaseStats->GenerateMana(creatureTemplate));
-                creature->SetPower(POWER_MANA, creature->GetMaxPower(POWER_MANA) * currentManaPercent);
-            }
+    }
 
-            // armor
-            creature->SetArmor(origCreatureBaseStats->GenerateArmor(creatureTemplate));
+    // Put a reset creature back to its original stats when no scaled stats were applied after all
+    void RestoreCreatureBaseStats(Creature* creature)
+    {
+        DungeonScaleCreatureInfo *creatureDSInfo=creature->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
 
-            // restore the saved data
-            creatureDSInfo->UnmodifiedLevel = unmodifiedLevel;
-            creatureDSInfo->isActive = isActive;
-            creatureDSInfo->wasAliveNowDead = wasAliveNowDead;
-            creatureDSInfo->isInCreatureList = isInCreatureList;
+        creatureDSInfo->isAwaitingScaledStats = false;
 
-            // damage and ccduration are handled using DungeonScaleCreatureInfo data only
+        // grab the creature's template and the original creature's stats
+        CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate();
+        DungeonScaleBaseStats const origBaseStats = GetCreatureOriginalBaseStats(creatureTemplate, creatureDSInfo->UnmodifiedLevel);
 
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::ResetCreatureIfNeeded: Creature {} ({}) is reset to its original stats.",
-                        creature->GetName(),
-                        creature->GetLevel()
-            );
+        // health
+        float currentHealthPercent = (float)creature->GetHealth() / (float)creature->GetMaxHealth();
+        creature->SetMaxHealth(origBaseStats.health);
+        creature->SetHealth((float)origBaseStats.health * currentHealthPercent);
 
-            // return true to indicate that the creature was reset
-            return true;
+        // mana
+        if (creature->getPowerType() == POWER_MANA && creature->GetPower(POWER_MANA) >= 0 && creature->GetMaxPower(POWER_MANA) > 0)
+        {
+            float currentManaPercent = creature->GetPower(POWER_MANA) / creature->GetMaxPower(POWER_MANA);
+            creature->SetMaxPower(POWER_MANA, origBaseStats.mana);
+            creature->SetPower(POWER_MANA, creature->GetMaxPower(POWER_MANA) * currentManaPercent);
         }
 
-        // creature was not reset, return false
-        return false;
+        // armor
+        creature->SetArmor(origBaseStats.armor);
 
+        // damage and ccduration are handled using DungeonScaleCreatureInfo data only
+
+        LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::RestoreCreatureBaseStats: Creature {} ({}) is reset to its original stats.",
+                    creature->GetName(),
+                    creature->GetLevel()
+        );
     }
 
     void ModifyCreatureAttributes(Creature* creature)
     {
+        DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_MODIFY_CREATURE_ATTRIBUTES);
+
         // make sure we have a creature
         if (!creature)
         {
@@ -4641,6 +4787,8 @@ public:
         InstanceMap* instanceMap = map->ToInstanceMap();
         DungeonScaleMapInfo *mapDSInfo=instanceMap->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
 
+        DUNGEONSCALE_PROBE3(creature__rescale__start, map->GetId(), map->GetInstanceId(), creature->GetEntry());
+
         // mark the creature as updated using the current settings if needed
         // if this creature is brand new, do not update this so that it will be re-processed next OnCreatureUpdate
         if (creatureDSInfo->mapConfigTime < mapDSInfo->mapConfigTime && !creatureDSInfo->isBrandNew)
@@ -4673,6 +4821,7 @@ public:
         }
 
         CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate();
+        DungeonScaleCreatureTemplateInfo const& templateInfo = GetCreatureTemplateInfo(creatureTemplate->Entry);
 
         // Add special rules for the ICC 
         // TODO: Handle this better
@@ -4721,21 +4870,21 @@ public:
         // if this is a trigger, still modify it
         if (
             (
-                (creatureDSInfo->UnmodifiedLevel < (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f)) ||
-                (creatureDSInfo->UnmodifiedLevel > (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f))
+                (creatureDSInfo->UnmodifiedLevel < mapDSInfo->lfgMinLevelBound) ||
+                (creatureDSInfo->UnmodifiedLevel > mapDSInfo->lfgMaxLevelBound)
             ) &&
             (
-                !(creature->IsCritter() && creatureDSInfo->UnmodifiedLevel >= 5 && creature->GetMaxHealth() > 100) &&
-                !creature->IsTrigger()
+                !(templateInfo.isCritter && creatureDSInfo->UnmodifiedLevel >= 5 && creature->GetMaxHealth() > 100) &&
+                !templateInfo.isTrigger
             )
         )
         {
             LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is a {} outside of the expected NPC level range for the map ({} to {}), not modified.",
                         creature->GetName(),
                         creatureDSInfo->UnmodifiedLevel,
-                        creature->IsCritter() ? "critter" : "creature",
-                        (uint8)(((float)mapDSInfo->lfgMinLevel * .85f) + 0.5f),
-                        (uint8)(((float)mapDSInfo->lfgMaxLevel * 1.15f) + 0.5f)
+                        templateInfo.isCritter ? "critter" : "creature",
+                        mapDSInfo->lfgMinLevelBound,
+                        mapDSInfo->lfgMaxLevelBound
             );
 
             creatureDSInfo->selectedLevel = creatureDSInfo->UnmodifiedLevel;
@@ -4758,7 +4907,7 @@ public:
         }
 
         // check to see if the creature is in the forced num players list
-        uint32 forcedNumPlayers = GetForcedNumPlayers(creatureTemplate->Entry);
+        uint32 forcedNumPlayers = templateInfo.forcedNumPlayers;
 
         if (forcedNumPlayers == 0)
         {
@@ -4777,16 +4926,18 @@ public:
             adjustedPlayerCount = forcedNumPlayers;
         }
 
-        // store the current player count in the creature and map's data
-        creatureDSInfo->instancePlayerCount = adjustedPlayerCount;
+        // store the current player count in the creature's data, as adjusted by the module hooks
+        uint32 instancePlayerCount = adjustedPlayerCount;
+        bool isModifyAllowed = instancePlayerCount && sDSScriptMgr->OnBeforeModifyAttributes(creature, instancePlayerCount);
+        creatureDSInfo->instancePlayerCount = instancePlayerCount;
 
-        if (!creatureDSInfo->instancePlayerCount) // no players in map, do not modify attributes
+        if (!adjustedPlayerCount) // no players in map, do not modify attributes
         {
             LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | is on a map with no players, not changed.", creature->GetName(), creatureDSInfo->UnmodifiedLevel);
             return;
         }
 
-        if (!sDSScriptMgr->OnBeforeModifyAttributes(creature, creatureDSInfo->instancePlayerCount))
+        if (!isModifyAllowed)
             return;
 
         // only scale levels if level scaling is enabled and the instance's average creature level is not within the skip range
@@ -4802,295 +4953,126 @@ public:
             return;
         }
 
-        CreatureBaseStats const* origCreatureBaseStats = sObjectMgr->GetCreatureBaseStats(creatureDSInfo->UnmodifiedLevel, creatureTemplate->unit_class);
-        CreatureBaseStats const* newCreatureBaseStats = sObjectMgr->GetCreatureBaseStats(creatureDSInfo->selectedLevel, creatureTemplate->unit_class);
-
-        // Inflection Point
-        DungeonScaleInflectionPointSettings inflectionPointSettings = getInflectionPointSettings(instanceMap, isBossOrBossSummon(creature));
-
-        // Generate the default multiplier
-        float defaultMultiplier = getDefaultMultiplier(instanceMap, inflectionPointSettings);
-
-        if (!sDSScriptMgr->OnAfterDefaultMultiplier(creature, defaultMultiplier))
-            return;
-
-        // Stat Modifiers
-        DungeonScaleStatModifiers statModifiers = getStatModifiers(map, creature);
-        float statMod_global        = statModifiers.global;
-        float statMod_health        = statModifiers.health;
-        float statMod_mana          = statModifiers.mana;
-        float statMod_armor         = statModifiers.armor;
-        float statMod_damage        = statModifiers.damage;
-        float statMod_ccDuration    = statModifiers.ccduration;
-
-        // Storage for the final values applied to the creature
-        uint32 newFinalHealth = 0;
-        uint32 newFinalMana = 0;
-        uint32 newFinalArmor = 0;
-
-        //
-        //  Health Scaling
-        //
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- HEALTH MULTIPLIER ----------",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel
-        );
-
-        float healthMultiplier = defaultMultiplier * statMod_global * statMod_health;
-
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | HealthMultiplier: ({}) = defaultMultiplier ({}) * statMod_global ({}) * statMod_health ({})",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    healthMultiplier,
-                    defaultMultiplier,
-                    statMod_global,
-                    statMod_health
-        );
-
-        // Can't be less than MinHPModifier
-        if (healthMultiplier <= MinHPModifier)
-        {
-            healthMultiplier = MinHPModifier;
-
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | HealthMultiplier: ({}) - capped to MinHPModifier ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        healthMultiplier,
-                        MinHPModifier
-            );
-        }
-
-        // set the non-level-scaled health multiplier on the creature's DS info
-        creatureDSInfo->HealthMultiplier = healthMultiplier;
-
-        // the original health of the creature
-        uint32 origHealth = origCreatureBaseStats->GenerateHealth(creatureTemplate);
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origHealth ({}) = origCreatureBaseStats->GenerateHealth(creatureTemplate)",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    origHealth
-        );
-
-        // the actual health value to be applied to the player-scaled creature
-        newFinalHealth = round(origHealth * creatureDSInfo->HealthMultiplier);
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalHealth ({}) = origHealth ({}) * HealthMultiplier ({})",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    newFinalHealth,
-                    origHealth,
-                    creatureDSInfo->HealthMultiplier
-        );
-
-        //
-        //  Mana Scaling
-        //
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- MANA MULTIPLIER ----------",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel
-        );
-
-        float manaMultiplier = defaultMultiplier * statMod_global * statMod_mana;
+        DungeonScaleBaseStats const origBaseStats = GetCreatureOriginalBaseStats(creatureTemplate, creatureDSInfo->UnmodifiedLevel);
 
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ManaMultiplier: ({}) = defaultMultiplier ({}) * statMod_global ({}) * statMod_mana ({})",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    manaMultiplier,
-                    defaultMultiplier,
-                    statMod_global,
-                    statMod_mana
-        );
-
-        // Can't be less than MinManaModifier
-        if (manaMultiplier <= MinManaModifier)
-        {
-            manaMultiplier = MinManaModifier;
+        // the boss flag is resolved when the creature is added to the map, only resolve it here if that hasn't happened yet
+        if (!creatureDSInfo->isBossResolved)
+            ResolveCreatureBossFlag(creature, creatureDSInfo);
 
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ManaMultiplier: ({}) - capped to MinManaModifier ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        manaMultiplier,
-                        MinManaModifier
-            );
-        }
+        bool isBoss = creatureDSInfo->isBoss;
+        float defaultMultiplier;
+        DungeonScaleStatModifiers statModifiers;
 
-        // if the creature doesn't have mana, set the multiplier to 0.0
-        if (!origCreatureBaseStats->GenerateMana(creatureTemplate))
+        // summons sharing a profile share their stat inputs as long as the map's scaling doesn't change
+        DungeonScaleSummonProfile* summonProfile = _getSummonProfile(creature, creatureDSInfo, mapDSInfo);
+        if (summonProfile && summonProfile->hasStats)
         {
-            manaMultiplier = 0.0f;
-            creatureDSInfo->ManaMultiplier = 0.0f;
-
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Creature doesn't have mana, multiplier set to ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        creatureDSInfo->ManaMultiplier
-            );
+            defaultMultiplier = summonProfile->defaultMultiplier;
+            statModifiers = summonProfile->statModifiers;
         }
-        // if the creature has mana, continue calculations
         else
         {
-            // set the non-level-scaled mana multiplier on the creature's DS info
-            creatureDSInfo->ManaMultiplier = manaMultiplier;
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ManaMultiplier: ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        creatureDSInfo->ManaMultiplier
-            );
-
-            // the original mana of the creature
-            uint32 origMana = origCreatureBaseStats->GenerateMana(creatureTemplate);
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origMana ({}) = origCreatureBaseStats->GenerateMana(creatureTemplate)",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        origMana
-            );
-
-            // the actual mana value to be applied to the player-scaled creature
-            newFinalMana = round(origMana * creatureDSInfo->ManaMultiplier);
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalMana ({}) = origMana ({}) * creatureDSInfo->ManaMultiplier ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        newFinalMana,
-                        origMana,
-                        creatureDSInfo->ManaMultiplier
-            );
-        }
+            // Inflection Point
+            DungeonScaleInflectionPointSettings inflectionPointSettings = getInflectionPointSettings(instanceMap, isBoss);
 
-        //
-        //  Armor Scaling
-        //
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- ARMOR MULTIPLIER ----------",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel
-        );
+            // Generate the default multiplier
+            defaultMultiplier = getDefaultMultiplier(instanceMap, inflectionPointSettings);
 
-        float armorMultiplier = defaultMultiplier * statMod_global * statMod_armor;
+            // Stat Modifiers
+            statModifiers = getStatModifiers(map, creature, isBoss);
 
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | armorMultiplier: ({}) = defaultMultiplier ({}) * statMod_global ({}) * statMod_armor ({})",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    armorMultiplier,
-                    defaultMultiplier,
-                    statMod_global,
-                    statMod_armor
-        );
+            if (summonProfile)
+            {
+                summonProfile->defaultMultiplier = defaultMultiplier;
+                summonProfile->statModifiers = statModifiers;
+                summonProfile->hasStats = true;
+            }
+        }
 
-        // set the non-level-scaled armor multiplier on the creature's DS info
-        creatureDSInfo->ArmorMultiplier = armorMultiplier;
+        if (!sDSScriptMgr->OnAfterDefaultMultiplier(creature, defaultMultiplier))
+            return;
 
-        // the original armor of the creature
-        uint32 origArmor = origCreatureBaseStats->GenerateArmor(creatureTemplate);
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | origArmor ({}) = origCreatureBaseStats->GenerateArmor(creatureTemplate)",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    origArmor
-        );
+        // the multipliers, with the configured minimums and CC duration range applied
+        DungeonScaleCreatureMultipliers multipliers = CalculateCreatureMultipliers(engineConfig, defaultMultiplier, statModifiers, origBaseStats.mana);
+
+        float healthMultiplier = multipliers.health;
+        float manaMultiplier = multipliers.mana;
+        float armorMultiplier = multipliers.armor;
+        float damageMultiplier = multipliers.damage;
+        float ccDurationMultiplier = multipliers.ccDuration;
 
-        // the actual armor value to be applied to the player-scaled creature
-        newFinalArmor = round(origArmor * creatureDSInfo->ArmorMultiplier);
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalArmor ({}) = origArmor ({}) * creatureDSInfo->ArmorMultiplier ({})",
+        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | defaultMultiplier ({}) | statModifiers global ({}) health ({}) mana ({}) armor ({}) damage ({}) ccDuration ({})",
                     creature->GetName(),
                     creatureDSInfo->selectedLevel,
-                    newFinalArmor,
-                    origArmor,
-                    creatureDSInfo->ArmorMultiplier
+                    defaultMultiplier,
+                    statModifiers.global,
+                    statModifiers.health,
+                    statModifiers.mana,
+                    statModifiers.armor,
+                    statModifiers.damage,
+                    statModifiers.ccduration
         );
 
-        //
-        //  Damage Scaling
-        //
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- DAMAGE MULTIPLIER ----------",
+        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | multipliers health ({}) mana ({}) armor ({}) damage ({}) ccDuration ({})",
                     creature->GetName(),
-                    creatureDSInfo->selectedLevel
+                    creatureDSInfo->selectedLevel,
+                    healthMultiplier,
+                    manaMultiplier,
+                    armorMultiplier,
+                    damageMultiplier,
+                    ccDurationMultiplier
         );
 
-        float damageMultiplier = defaultMultiplier * statMod_global * statMod_damage;
+        // the actual values to be applied to the player-scaled creature
+        uint32 newFinalHealth = round(origBaseStats.health * healthMultiplier);
+        uint32 newFinalMana = round(origBaseStats.mana * manaMultiplier);
+        uint32 newFinalArmor = round(origBaseStats.armor * armorMultiplier);
 
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | DamageMultiplier: ({}) = defaultMultiplier ({}) * statMod_global ({}) * statMod_damage ({})",
+        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | newFinalHealth ({}) = origHealth ({}) * healthMultiplier | newFinalMana ({}) = origMana ({}) * manaMultiplier | newFinalArmor ({}) = origArmor ({}) * armorMultiplier",
                     creature->GetName(),
                     creatureDSInfo->selectedLevel,
-                    damageMultiplier,
-                    defaultMultiplier,
-                    statMod_global,
-                    statMod_damage
+                    newFinalHealth,
+                    origBaseStats.health,
+                    newFinalMana,
+                    origBaseStats.mana,
+                    newFinalArmor,
+                    origBaseStats.armor
         );
 
-        // Can't be less than MinDamageModifier
-        if (damageMultiplier <= MinDamageModifier)
-        {
-            damageMultiplier = MinDamageModifier;
-
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | DamageMultiplier: ({}) - capped to MinDamageModifier ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        damageMultiplier,
-                        MinDamageModifier
-            );
-        }
-
         // set the non-level-scaled damage multiplier on the creature's DS info
         creatureDSInfo->DamageMultiplier = damageMultiplier;
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | DamageMultiplier: ({})",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    creatureDSInfo->DamageMultiplier
-        );
 
         //
-        // Crowd Control Debuff Duration Scaling
+        //  Apply New Values
         //
+        if (!sDSScriptMgr->OnBeforeUpdateStats(creature, newFinalHealth, newFinalMana, damageMultiplier, newFinalArmor))
+            return;
 
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ---------- CC DURATION MULTIPLIER ----------",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel
-        );
-
-        float ccDurationMultiplier;
-
-        if (statMod_ccDuration != -1.0f)
-        {
-            // calculate CC Duration from the default multiplier and the config settings
-            ccDurationMultiplier = defaultMultiplier * statMod_ccDuration;
-
-            // Min/Max checking
-            if (ccDurationMultiplier < MinCCDurationModifier)
-            {
-                ccDurationMultiplier = MinCCDurationModifier;
-            }
-            else if (ccDurationMultiplier > MaxCCDurationModifier)
-            {
-                ccDurationMultiplier = MaxCCDurationModifier;
-            }
+        // the scaled values are written over the previous ones, a pending rescale needs no separate reset
+        creatureDSInfo->isAwaitingScaledStats = false;
 
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ccDurationMultiplier: ({})",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel,
-                        ccDurationMultiplier
-            );
-        }
-        else
+        if (mapDSInfo->recorder)
         {
-            // the CC Duration will not be changed
-            ccDurationMultiplier = 1.0f;
-            LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Crowd Control Duration will not be changed.",
-                        creature->GetName(),
-                        creatureDSInfo->selectedLevel
-            );
+            DungeonScaleRecord& record = mapDSInfo->recorder->Append(DUNGEONSCALE_RECORD_CREATURE_RESCALE, creature->GetEntry(), GetSteadyTimeMS());
+            record.flags = (isBoss ? DUNGEONSCALE_RECORD_FLAG_BOSS : 0) | (origBaseStats.mana ? DUNGEONSCALE_RECORD_FLAG_HAS_MANA : 0);
+            record.playerCount = mapDSInfo->adjustedPlayerCount;
+            record.values[0] = defaultMultiplier;
+            record.values[1] = healthMultiplier;
+            record.values[2] = manaMultiplier;
+            record.values[3] = armorMultiplier;
+            record.values[4] = damageMultiplier;
+            record.values[5] = ccDurationMultiplier;
         }
 
-        LOG_DEBUG("module.DungeonScale_StatGeneration", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | ccDurationMultiplier: ({}) = defaultMultiplier ({}) * statMod_ccDuration ({})",
-                    creature->GetName(),
-                    creatureDSInfo->selectedLevel,
-                    ccDurationMultiplier,
-                    defaultMultiplier,
-                    statMod_ccDuration
+        DUNGEONSCALE_PROBE6(creature__rescale,
+            map->GetId(),
+            map->GetInstanceId(),
+            creature->GetEntry(),
+            mapDSInfo->adjustedPlayerCount,
+            GetProbeMultiplier(healthMultiplier),
+            GetProbeMultiplier(damageMultiplier)
         );
 
-        //
-        //  Apply New Values
-        //
-        if (!sDSScriptMgr->OnBeforeUpdateStats(creature, newFinalHealth, newFinalMana, damageMultiplier, newFinalArmor))
-            return;
-
         uint32 prevMaxHealth = creature->GetMaxHealth();
         uint32 prevMaxPower = creature->GetMaxPower(Powers::POWER_MANA);
         uint32 prevHealth = creature->GetHealth();
@@ -5123,8 +5105,8 @@ public:
         if
         (
             creature->IsSummon() &&
-            _isSummonCloneOfSummoner(creature) &&
-            !creatureDSInfo->isCloneOfSummoner
+            !creatureDSInfo->isCloneOfSummoner &&
+            _isSummonCloneOfSummoner(creature)
         )
         {
             creatureDSInfo->isCloneOfSummoner = true;
@@ -5353,9 +5335,9 @@ public:
                     creature->GetName(),
                     creatureDSInfo->UnmodifiedLevel,
                     creatureDSInfo->selectedLevel,
-                    creatureDSInfo->HealthMultiplier,
-                    creatureDSInfo->ManaMultiplier,
-                    creatureDSInfo->ArmorMultiplier,
+                    healthMultiplier,
+                    manaMultiplier,
+                    armorMultiplier,
                     creatureDSInfo->DamageMultiplier,
                     creatureDSInfo->CCDurationMultiplier,
                     creatureDSInfo->XPModifier,
@@ -5367,9 +5349,9 @@ public:
             LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::ModifyCreatureAttributes: Creature {} ({}) | Multipliers: H:{:.3f} M:{:.3f} A:{:.3f} D:{:.3f} CC:{:.3f} XP:{:.3f} $:{:.3f}",
                     creature->GetName(),
                     creatureDSInfo->UnmodifiedLevel,
-                    creatureDSInfo->HealthMultiplier,
-                    creatureDSInfo->ManaMultiplier,
-                    creatureDSInfo->ArmorMultiplier,
+                    healthMultiplier,
+                    manaMultiplier,
+                    armorMultiplier,
                     creatureDSInfo->DamageMultiplier,
                     creatureDSInfo->CCDurationMultiplier,
                     creatureDSInfo->XPModifier,
@@ -5381,6 +5363,103 @@ public:
     }
 
 private:
+    // the summoning creature, if this is a summon of a creature
+    Creature* _getCreatureSummoner(Creature* creature)
+    {
+        if (!creature->IsSummon() || !creature->ToTempSummon() || !creature->ToTempSummon()->GetSummoner())
+            return nullptr;
+
+        return creature->ToTempSummon()->GetSummoner()->ToCreature();
+    }
+
+    uint64 _getSummonProfileKey(Creature* creature, ObjectGuid summonerGUID)
+    {
+        return (uint64(creature->GetEntry()) << 32) | summonerGUID.GetCounter();
+    }
+
+    // the creature's summon profile if it is still valid for the map's current scaling
+    DungeonScaleSummonProfile* _getSummonProfile(Creature* creature, DungeonScaleCreatureInfo const* creatureDSInfo, DungeonScaleMapInfo* mapDSInfo)
+    {
+        if (!creature->IsSummon() || creatureDSInfo->summonerGUID.IsEmpty())
+            return nullptr;
+
+        auto profileIterator = mapDSInfo->summonProfiles.find(_getSummonProfileKey(creature, creatureDSInfo->summonerGUID));
+        if (profileIterator == mapDSInfo->summonProfiles.end())
+            return nullptr;
+
+        DungeonScaleSummonProfile* summonProfile = &profileIterator->second;
+        if (
+            summonProfile->mapConfigTime != mapDSInfo->mapConfigTime ||
+            summonProfile->adjustedPlayerCount != mapDSInfo->adjustedPlayerCount ||
+            summonProfile->UnmodifiedLevel != creatureDSInfo->UnmodifiedLevel
+        )
+            return nullptr;
+
+        return summonProfile;
+    }
+
+    void _recordSummonProfile(Creature* creature, DungeonScaleCreatureInfo const* creatureDSInfo, uint8 spawnLevel)
+    {
+        // only summons of creatures that got a level assigned are worth reusing
+        if (!_getCreatureSummoner(creature) || creatureDSInfo->summonerGUID.IsEmpty() || !creatureDSInfo->selectedLevel)
+            return;
+
+        DungeonScaleMapInfo* mapDSInfo = creature->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+
+        DungeonScaleSummonProfile& summonProfile = mapDSInfo->summonProfiles[_getSummonProfileKey(creature, creatureDSInfo->summonerGUID)];
+        summonProfile = DungeonScaleSummonProfile();
+        summonProfile.mapConfigTime = mapDSInfo->mapConfigTime;
+        summonProfile.adjustedPlayerCount = mapDSInfo->adjustedPlayerCount;
+        summonProfile.spawnLevel = spawnLevel;
+        summonProfile.UnmodifiedLevel = creatureDSInfo->UnmodifiedLevel;
+        summonProfile.neverLevelScale = creatureDSInfo->neverLevelScale;
+        summonProfile.isBoss = creatureDSInfo->isBoss;
+    }
+
+    // resolve a brand new summon from the profile of an identical earlier summon, skipping the map list and the first modify pass
+    bool _applySummonProfile(Creature* creature, DungeonScaleCreatureInfo* creatureDSInfo, uint8 spawnLevel)
+    {
+        Creature* summoner = _getCreatureSummoner(creature);
+        if (!summoner)
+            return false;
+
+        DungeonScaleMapInfo* mapDSInfo = creature->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+
+        auto profileIterator = mapDSInfo->summonProfiles.find(_getSummonProfileKey(creature, summoner->GetGUID()));
+        if (profileIterator == mapDSInfo->summonProfiles.end())
+            return false;
+
+        DungeonScaleSummonProfile const& summonProfile = profileIterator->second;
+        if (
+            summonProfile.mapConfigTime != mapDSInfo->mapConfigTime ||
+            summonProfile.adjustedPlayerCount != mapDSInfo->adjustedPlayerCount ||
+            summonProfile.spawnLevel != spawnLevel
+        )
+            return false;
+
+        creatureDSInfo->summonerGUID = summoner->GetGUID();
+        creatureDSInfo->UnmodifiedLevel = summonProfile.UnmodifiedLevel;
+
+        // relevance depends on the summon itself (who controls it, who it is hostile to), not on the profile key
+        if (!isCreatureRelevant(creature))
+            return false;
+
+        creatureDSInfo->selectedLevel = summonProfile.UnmodifiedLevel;
+        creatureDSInfo->neverLevelScale = summonProfile.neverLevelScale;
+        creatureDSInfo->isBoss = summonProfile.isBoss;
+        creatureDSInfo->isBossResolved = true;
+
+        LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_applySummonProfile: Creature {} ({}) (summon) | reuses the profile of an earlier summon by {} ({}), will spawn in as level ({}).",
+                    creature->GetName(),
+                    creatureDSInfo->UnmodifiedLevel,
+                    summoner->GetName(),
+                    summoner->GetEntry(),
+                    creatureDSInfo->selectedLevel
+        );
+
+        return true;
+    }
+
     bool _isSummonCloneOfSummoner(Creature* summon)
     {
         // if the summon doesn't exist or isn't a summon
@@ -5393,7 +5472,7 @@ private:
         DungeonScaleCreatureInfo* summonDSInfo = summon->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
 
         // get the saved summoner
-        Creature* summoner = summonDSInfo->summoner;
+        Creature* summoner = !summonDSInfo->summonerGUID.IsEmpty() ? ObjectAccessor::GetCreature(*summon, summonDSInfo->summonerGUID) : nullptr;
 
         // if the summoner doesn't exist
         if (!summoner)
@@ -5401,132 +5480,82 @@ private:
             return false;
         }
 
-        // if this creature's ID is in the list of creatures that are not clones of their summoner (creatureIDsThatAreNotClones), return false
-        if (
-            std::find
-            (
-                creatureIDsThatAreNotClones.begin(),
-                creatureIDsThatAreNotClones.end(),
-                summon->GetEntry()
-            ) != creatureIDsThatAreNotClones.end()
-        )
-        {
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | creatureIDsThatAreNotClones contains this creature's ID ({}) | false",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetEntry()
-            );
-            return false;
-        }
+        // entry, type and name only depend on the (summon entry, summoner entry) pair, score them once per map
+        DungeonScaleMapInfo* mapDSInfo = summon->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+        uint64 cloneKey = (uint64(summon->GetEntry()) << 32) | summoner->GetEntry();
+
+        auto staticScoreIterator = mapDSInfo->cloneStaticScores.find(cloneKey);
+        if (staticScoreIterator == mapDSInfo->cloneStaticScores.end())
+            staticScoreIterator = mapDSInfo->cloneStaticScores.emplace(cloneKey, _getCloneStaticScore(summon, summoner)).first;
 
+        int8 staticScore = staticScoreIterator->second;
 
         // create a running score for this check
-        int8 score = 0;
+        // the max health (+3) and display ID (+1) are only compared when they can still change the verdict
+        int8 score = staticScore;
+        bool healthMatches = false;
+        bool displayIdMatches = false;
+
+        if (score < 5 && score + 4 >= 5)
+        {
+            // if the max health is the same, +3
+            healthMatches = summon->GetMaxHealth() == summoner->GetMaxHealth();
+            if (healthMatches)
+                score += 3;
+
+            // if the display ID is the same, +1
+            if (score < 5 && score + 1 >= 5)
+            {
+                displayIdMatches = summon->GetDisplayId() == summoner->GetDisplayId();
+                if (displayIdMatches)
+                    score += 1;
+            }
+        }
+
+        // if the score is at least 5, consider this a clone
+        bool isClone = score >= 5;
 
-        LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | Is this a clone of it's summoner {} ({})?",
+        LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | summoner {} ({}) | static score ({}){}{} | score ({}) {} 5 | {}",
                     summon->GetName(),
                     summonDSInfo->selectedLevel,
                     summoner->GetName(),
-                    summoner->GetLevel()
+                    summoner->GetLevel(),
+                    staticScore,
+                    healthMatches ? " + MaxHealth (3)" : "",
+                    displayIdMatches ? " + DisplayId (1)" : "",
+                    score,
+                    isClone ? ">=" : "<",
+                    isClone ? "true" : "false"
         );
 
+        return isClone;
+    }
+
+    // the part of the clone score that only depends on the two creature entries
+    int8 _getCloneStaticScore(Creature* summon, Creature* summoner)
+    {
+        // creatures in creatureIDsThatAreNotClones can never reach the threshold
+        if (creatureIDsThatAreNotClones.count(summon->GetEntry()))
+            return 0;
+
+        int8 score = 0;
 
         // if the entry ID is the same, +2
         if (summon->GetEntry() == summoner->GetEntry())
-        {
             score += 2;
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | Entry: ({}) == ({}) | score: +2 = ({})",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetEntry(),
-                        summoner->GetEntry(),
-                        score
-            );
-        }
-
-        // if the max health is the same, +3
-        if (summon->GetMaxHealth() == summoner->GetMaxHealth())
-        {
-            score += 3;
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | MaxHealth: ({}) == ({}) | score: +3 = ({})",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetMaxHealth(),
-                        summoner->GetMaxHealth(),
-                        score
-            );
-        }
 
         // if the type (humanoid, dragonkin, etc) is the same, +1
         if (summon->GetCreatureType() == summoner->GetCreatureType())
-        {
             score += 1;
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | CreatureType: ({}) == ({}) | score: +1 = ({})",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetCreatureType(),
-                        summoner->GetCreatureType(),
-                        score
-            );
-        }
 
         // if the name is the same, +2
         if (summon->GetName() == summoner->GetName())
-        {
             score += 2;
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | Name: ({}) == ({}) | score: +2 = ({})",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetName(),
-                        summoner->GetName(),
-                        score
-            );
-        }
         // if the summoner's name is a part of the summon's name, +1
         else if (summon->GetName().find(summoner->GetName()) != std::string::npos)
-        {
-            score += 1;
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | Name: ({}) contains ({}) | score: +1 = ({})",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetName(),
-                        summoner->GetName(),
-                        score
-            );
-        }
-
-        // if the display ID is the same, +1
-        if (summon->GetDisplayId() == summoner->GetDisplayId())
-        {
             score += 1;
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | DisplayId: ({}) == ({}) | score: +1 = ({})",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        summon->GetDisplayId(),
-                        summoner->GetDisplayId(),
-                        score
-            );
-        }
 
-        // if the score is at least 5, consider this a clone
-        if (score >= 5)
-        {
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | score ({}) >= 5 | true",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        score
-            );
-            return true;
-        }
-        else
-        {
-            LOG_DEBUG("module.DungeonScale", "DungeonScale_AllCreatureScript::_isSummonCloneOfSummoner: Creature {} ({}) | score ({}) < 5 | false",
-                        summon->GetName(),
-                        summonDSInfo->selectedLevel,
-                        score
-            );
-            return false;
-        }
+        return score;
     }
 };
 class DungeonScale_CommandScript : public CommandScript
@@ -5541,6 +5570,9 @@ public:
             { "setplayers",        HandleDSPlayerOffsetCommand,     SEC_PLAYER,     Console::No },
             { "getmapstat",        HandleDSMapStatsCommand,         SEC_PLAYER,     Console::No },
             { "getcreaturestat",   HandleDSCreatureStatsCommand,    SEC_PLAYER,     Console::No },
+            { "history",           HandleDSHistoryCommand,          SEC_PLAYER,     Console::No },
+            { "perf",              HandleDSPerfCommand,             SEC_GAMEMASTER, Console::Yes },
+            { "record",            HandleDSRecordCommand,           SEC_GAMEMASTER, Console::No },
         };
 
         static ChatCommandTable commandTable =
@@ -5597,6 +5629,7 @@ public:
             DungeonScaleMapInfo* mapDSInfo = player->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
             mapDSInfo->overridePlayerCount = (uint8)newOffset;
             mapDSInfo->globalConfigTime = mapDSInfo->globalConfigTime - 1;
+            SetRescaleTrigger(mapDSInfo, DUNGEONSCALE_RESCALE_TRIGGER_SET_PLAYERS);
 
             return true;
         }
@@ -5640,17 +5673,17 @@ public:
             {
                 handler->PSendSysMessage("Adjusted Player Count: {} (Combat Locked)", mapDSInfo->adjustedPlayerCount);
             }
-            else if (mapDSInfo->playerCount < mapDSInfo->minPlayers && !PlayerCountDifficultyOffset)
+            else if (mapDSInfo->playerCount < mapDSInfo->minPlayers && !engineConfig.playerCountDifficultyOffset)
             {
                 handler->PSendSysMessage("Adjusted Player Count: {} (Map Minimum)", mapDSInfo->adjustedPlayerCount);
             }
-            else if (mapDSInfo->playerCount < mapDSInfo->minPlayers && PlayerCountDifficultyOffset)
+            else if (mapDSInfo->playerCount < mapDSInfo->minPlayers && engineConfig.playerCountDifficultyOffset)
             {
-                handler->PSendSysMessage("Adjusted Player Count: {} (Map Minimum + Difficulty Offset of {})", mapDSInfo->adjustedPlayerCount, PlayerCountDifficultyOffset);
+                handler->PSendSysMessage("Adjusted Player Count: {} (Map Minimum + Difficulty Offset of {})", mapDSInfo->adjustedPlayerCount, engineConfig.playerCountDifficultyOffset);
             }
-            else if (PlayerCountDifficultyOffset)
+            else if (engineConfig.playerCountDifficultyOffset)
             {
-                handler->PSendSysMessage("Adjusted Player Count: {} (Difficulty Offset of {})", mapDSInfo->adjustedPlayerCount, PlayerCountDifficultyOffset);
+                handler->PSendSysMessage("Adjusted Player Count: {} (Difficulty Offset of {})", mapDSInfo->adjustedPlayerCount, engineConfig.playerCountDifficultyOffset);
             }
             else
             {
@@ -5681,6 +5714,13 @@ public:
                                     mapDSInfo->activeCreatureCount,
                                     mapDSInfo->allMapCreatures.size()
                                     );
+
+            // Rescale work (creatures out of every player's range are deferred until a player approaches)
+            handler->PSendSysMessage("Rescales Performed | Deferred (no player in range) | Never Needed (died or left while deferred): {} | {} | {}",
+                                    mapDSInfo->rescalesPerformed,
+                                    mapDSInfo->rescalesDeferred,
+                                    mapDSInfo->rescalesAvoided
+                                    );
             return true;
         }
         else
@@ -5707,34 +5747,178 @@ public:
             return true;
         }
 
-        DungeonScaleCreatureInfo *targetDSInfo=target->CustomData.GetDefault<DungeonScaleCreatureInfo>("DungeonScaleCreatureInfo");
+        DungeonScaleCreatureInfo const* targetDSInfo = GetCreatureInfo(target);
+
+        // the health, mana and armor multipliers aren't stored, derive them from the target's base stats at its current level
+        // they can differ from the applied ones once level scaling or other modules have changed the stats
+        CreatureTemplate const* targetTemplate = target->GetCreatureTemplate();
+        CreatureBaseStats const* targetBaseStats = sObjectMgr->GetCreatureBaseStats(target->GetLevel(), targetTemplate->unit_class);
+        uint32 targetBaseHealth = targetBaseStats->GenerateHealth(targetTemplate);
+        uint32 targetBaseMana = targetBaseStats->GenerateMana(targetTemplate);
+        uint32 targetBaseArmor = targetBaseStats->GenerateArmor(targetTemplate);
 
         handler->PSendSysMessage("---");
         handler->PSendSysMessage("{} ({}{}{}), {}",
                                   target->GetName(),
                                   targetDSInfo->UnmodifiedLevel,
                                   isCreatureRelevant(target) && targetDSInfo->UnmodifiedLevel != target->GetLevel() ? "->" + std::to_string(targetDSInfo->selectedLevel) : "",
-                                  isBossOrBossSummon(target) ? " | Boss" : "",
+                                  isBossOrBossSummonCached(target) ? " | Boss" : "",
                                   targetDSInfo->isActive ? "Active for Map Stats" : "Ignored for Map Stats");
         handler->PSendSysMessage("Creature difficulty level: {} player(s)", targetDSInfo->instancePlayerCount);
-        handler->PSendSysMessage("Health multiplier: {}", targetDSInfo->HealthMultiplier);
-        handler->PSendSysMessage("Mana multiplier: {}", targetDSInfo->ManaMultiplier);
-        handler->PSendSysMessage("Armor multiplier: {}", targetDSInfo->ArmorMultiplier);
+        handler->PSendSysMessage("Health multiplier (derived from current stats): {}", targetBaseHealth ? (float)target->GetMaxHealth() / targetBaseHealth : 1.0f);
+        handler->PSendSysMessage("Mana multiplier (derived from current stats): {}", targetBaseMana ? (float)target->GetMaxPower(POWER_MANA) / targetBaseMana : 0.0f);
+        handler->PSendSysMessage("Armor multiplier (derived from current stats): {}", targetBaseArmor ? (float)target->GetArmor() / targetBaseArmor : 1.0f);
         handler->PSendSysMessage("Damage multiplier: {}", targetDSInfo->DamageMultiplier);
         handler->PSendSysMessage("CC Duration multiplier: {}", targetDSInfo->CCDurationMultiplier);
         handler->PSendSysMessage("XP multiplier: {}  Money multiplier: {}", targetDSInfo->XPModifier, targetDSInfo->MoneyModifier);
 
         DungeonScaleMapInfo* mapDSInfo = target->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
         float lootDropChanceMultiplier = 1.0f;
-        if (RewardScalingLoot == true)
+        if (engineConfig.rewardScalingLoot == true)
             lootDropChanceMultiplier = float(mapDSInfo->adjustedPlayerCount) / float(target->GetMap()->ToInstanceMap()->GetMaxPlayers());
         float lootDropChanceBoPMultiplier = 1.0f;
-        if (RewardScalingLootBOPAlwaysDropException == false)
+        if (engineConfig.rewardScalingLootBOPAlwaysDropException == false)
             lootDropChanceBoPMultiplier = lootDropChanceMultiplier;
         handler->PSendSysMessage("Non-BOP,BOP Loot chance multipliers: {},{}", lootDropChanceMultiplier, lootDropChanceBoPMultiplier);
 
         return true;
     }
+
+    static bool HandleDSHistoryCommand(ChatHandler* handler, const char* args)
+    {
+        Player* player = handler->GetPlayer();
+        Map* map = player->GetMap();
+
+        if (!map->IsDungeon())
+        {
+            handler->PSendSysMessage("This command can only be used in a dungeon or raid.");
+            return true;
+        }
+
+        uint32 count = (args && *args) ? (uint32)atoi(args) : 5;
+        count = std::clamp<uint32>(count, 1, DUNGEONSCALE_RESCALE_HISTORY_SIZE);
+
+        DungeonScaleMapInfo* mapDSInfo = map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+        count = std::min<uint32>(count, mapDSInfo->rescaleHistoryCount);
+
+        handler->PSendSysMessage("---");
+        handler->PSendSysMessage("{} | ID {}-{} | Last {} rescale wave(s), newest first",
+                                map->GetMapName(),
+                                map->GetId(),
+                                map->GetInstanceId(),
+                                count
+                                );
+
+        uint64 now = GetSteadyTimeMS();
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            DungeonScaleRescaleWave const& wave = mapDSInfo->rescaleHistory[(mapDSInfo->rescaleHistoryNext + DUNGEONSCALE_RESCALE_HISTORY_SIZE - 1 - i) % DUNGEONSCALE_RESCALE_HISTORY_SIZE];
+
+            handler->PSendSysMessage("{}s ago | {} | {} players, level {}",
+                                    (now - wave.startTime) / 1000,
+                                    GetRescaleTriggerName(wave.trigger),
+                                    wave.adjustedPlayerCount,
+                                    wave.mapLevel
+                                    );
+            handler->PSendSysMessage("  Reset {} ({} restored) | Deferred {} | {:.2f}ms over {} tick(s) in {}ms",
+                                    wave.creaturesReset,
+                                    wave.creaturesRestored,
+                                    wave.creaturesDeferred,
+                                    wave.rescaleTimeNs / 1e6,
+                                    wave.ticks,
+                                    wave.lastRescaleTime ? wave.lastRescaleTime - wave.startTime : 0
+                                    );
+        }
+
+        return true;
+    }
+
+    static bool HandleDSPerfCommand(ChatHandler* handler, const char* args)
+    {
+        if (args && std::string(args) == "reset")
+        {
+            ResetPerfCounters();
+            handler->PSendSysMessage("DungeonScale hook counters reset.");
+            return true;
+        }
+
+        if (!perfSampleInterval)
+        {
+            handler->PSendSysMessage("DungeonScale hook instrumentation is off (DungeonScale.Perf.Enable).");
+            return true;
+        }
+
+        DungeonScalePerfSnapshot snapshot = GetPerfSnapshot();
+        double elapsedSeconds = std::max(snapshot.elapsedNs / 1e9, 0.001);
+
+        handler->PSendSysMessage("---");
+        handler->PSendSysMessage("DungeonScale hooks over the last {:.0f}s | {} thread(s) | 1 in {} calls timed",
+                                elapsedSeconds,
+                                snapshot.threadCount,
+                                perfSampleInterval.load()
+                                );
+        handler->PSendSysMessage("Hook: Calls (per second) | Mean | p50 | p99 | Total time per second");
+
+        for (uint8 hook = 0; hook < DUNGEONSCALE_PERF_HOOK_COUNT; ++hook)
+        {
+            DungeonScalePerfHookStats const& hookStats = snapshot.hooks[hook];
+            if (!hookStats.calls)
+                continue;
+
+            // the sampled mean stands in for the calls that weren't timed
+            handler->PSendSysMessage("{}: {} ({:.0f}/s) | {:.2f}us | <{:.2f}us | <{:.2f}us | {:.2f}ms/s",
+                                    GetPerfHookName((DungeonScalePerfHook)hook),
+                                    hookStats.calls,
+                                    hookStats.calls / elapsedSeconds,
+                                    hookStats.GetMeanNs() / 1000.0,
+                                    hookStats.GetQuantileNs(0.50) / 1000.0,
+                                    hookStats.GetQuantileNs(0.99) / 1000.0,
+                                    hookStats.GetMeanNs() * hookStats.calls / elapsedSeconds / 1e6
+                                    );
+        }
+
+        return true;
+    }
+
+    static bool HandleDSRecordCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        Player* player = handler->GetPlayer();
+        Map* map = player->GetMap();
+
+        if (!map->IsDungeon())
+        {
+            handler->PSendSysMessage("This command can only be used in a dungeon or raid.");
+            return true;
+        }
+
+        DungeonScaleMapInfo* mapDSInfo = map->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
+
+        if (!mapDSInfo->recorder)
+        {
+            handler->PSendSysMessage("This instance is not being recorded. DungeonScale.Recorder.Enable only applies to instances created after it was turned on.");
+            return true;
+        }
+
+        std::string recordingPath = SaveMapRecording(map, mapDSInfo);
+        if (recordingPath.empty())
+        {
+            handler->PSendSysMessage("The recording could not be written, check the server log.");
+            return true;
+        }
+
+        handler->PSendSysMessage("{} | ID {}-{} | {} event(s) written to {} ({} older event(s) overwritten, {} creature record(s) dropped)",
+                                map->GetMapName(),
+                                map->GetId(),
+                                map->GetInstanceId(),
+                                mapDSInfo->recorder->GetRecordCount(),
+                                recordingPath,
+                                mapDSInfo->recorder->GetDroppedRecords(),
+                                mapDSInfo->recorder->GetDroppedCreatureRecords()
+                                );
+
+        return true;
+    }
 };
 
 class DungeonScale_GlobalScript : public GlobalScript {
@@ -5743,6 +5927,10 @@ public:
 
     bool OnItemRoll(Player const* player, LootStoreItem const* lootStoreItem, float& /*chance*/, Loot& loot, LootStore const& /*lootStore*/) override
     {
+        DungeonScalePerfScope perfScope(DUNGEONSCALE_PERF_ON_ITEM_ROLL);
+
+        DUNGEONSCALE_PROBE2(loot__roll__start, player->GetMapId(), lootStoreItem->itemid);
+
         // Skip if not enabled
         if (EnableGlobal == false)
             return true;
@@ -5752,7 +5940,7 @@ public:
             return true;
 
         // Nothing if there is no scaling loot at play
-        if (RewardScalingLoot == false)
+        if (engineConfig.rewardScalingLoot == false)
             return true;
 
         // Always allow quest items
@@ -5769,39 +5957,28 @@ public:
         if (itemTemplate == NULL)
             return true;
 
-        // Enchanting materials not subjected to item scaling
-        if (itemTemplate->Class == ITEM_CLASS_TRADE_GOODS && itemTemplate->SubClass == ITEM_SUBCLASS_ENCHANTING)
-            return true;
-
-        // Duration (items that expire) are always exempted
-        if (itemTemplate->Duration > 0)
-            return true;
-
-        // Always return the loot if it's a BOP drop and configured to do so
-        if (RewardScalingLootBOPAlwaysDropException == true && itemTemplate->Bonding == BIND_WHEN_PICKED_UP)
-            return true;
+        // Enchanting materials, expiring items, BOP items, exception item IDs, containers and skinning
+        DungeonScaleLootItemDescriptor lootItem;
+        lootItem.itemId = itemTemplate->ItemId;
+        lootItem.isEnchantingMaterial = itemTemplate->Class == ITEM_CLASS_TRADE_GOODS && itemTemplate->SubClass == ITEM_SUBCLASS_ENCHANTING;
+        lootItem.isLeather = itemTemplate->Class == ITEM_CLASS_TRADE_GOODS && itemTemplate->SubClass == ITEM_SUBCLASS_LEATHER;
+        lootItem.expires = itemTemplate->Duration > 0;
+        lootItem.isBindOnPickup = itemTemplate->Bonding == BIND_WHEN_PICKED_UP;
+        lootItem.isFromContainer = loot.sourceGameObject && (loot.sourceGameObject->GetGoType() == GAMEOBJECT_TYPE_CHEST || loot.sourceGameObject->GetGoType() == GAMEOBJECT_TYPE_FISHINGNODE);
 
-        // Skip if exception itemID
-        if (isIntInList(RewardScalingExceptionItemIDs, itemTemplate->ItemId) == true)
+        if (IsLootItemExemptFromScaling(engineConfig, lootItem))
+        {
+            DUNGEONSCALE_PROBE5(loot__roll, player->GetMapId(), lootItem.itemId, 0, 0, 2);
             return true;
+        }
 
-        // If exempted, don't scale items from chests or gather points
-        if (RewardScalingExemptContainers == true)
-            if (loot.sourceGameObject && (loot.sourceGameObject->GetGoType() == GAMEOBJECT_TYPE_CHEST || loot.sourceGameObject->GetGoType() == GAMEOBJECT_TYPE_FISHINGNODE))
-                return true;
+        // Scale return
+        DungeonScaleMapDescriptor mapDescriptor = GetMapDescriptor(player->GetMap());
+        bool isKept = IsScaledLootRollKept(mapDescriptor, urand(1, mapDescriptor.maxPlayers));
 
-        // If exempted, don't scale items from skinning
-        if (RewardScalingExemptSkinning == true)
-            if (itemTemplate->Class == ITEM_CLASS_TRADE_GOODS && itemTemplate->SubClass == ITEM_SUBCLASS_LEATHER)
-                return true;
+        DUNGEONSCALE_PROBE5(loot__roll, mapDescriptor.mapId, lootItem.itemId, mapDescriptor.adjustedPlayerCount, mapDescriptor.maxPlayers, isKept ? 1 : 0);
 
-        // Scale return
-        DungeonScaleMapInfo* mapDSInfo = player->GetMap()->CustomData.GetDefault<DungeonScaleMapInfo>("DungeonScaleMapInfo");
-        uint32 randomPick = urand(1, player->GetMap()->ToInstanceMap()->GetMaxPlayers());
-        if (randomPick <= mapDSInfo->adjustedPlayerCount)
-            return true;
-        else
-            return false;
+        return isKept;
     };
 };
 
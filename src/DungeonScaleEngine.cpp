@@ -0,0 +1,610 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DungeonScaleEngine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+// spell IDs that spend player health
+// player abilities don't actually appear to be caught by `ModifySpellDamageTaken`,
+// but I'm leaving them here in case they ever DO get caught by it
+static std::list<uint32_t> const spellIdsThatSpendPlayerHealth =
+{
+    45529,      // Blood Tap
+    2687,       // Bloodrage
+    27869,      // Dark Rune
+    16666,      // Demonic Rune
+    755,        // Health Funnel (Rank 1)
+    3698,       // Health Funnel (Rank 2)
+    3699,       // Health Funnel (Rank 3)
+    3700,       // Health Funnel (Rank 4)
+    11693,      // Health Funnel (Rank 5)
+    11694,      // Health Funnel (Rank 6)
+    11695,      // Health Funnel (Rank 7)
+    27259,      // Health Funnel (Rank 8)
+    47856,      // Health Funnel (Rank 9)
+    1454,       // Life Tap (Rank 1)
+    1455,       // Life Tap (Rank 2)
+    1456,       // Life Tap (Rank 3)
+    11687,      // Life Tap (Rank 4)
+    11688,      // Life Tap (Rank 5)
+    11689,      // Life Tap (Rank 6)
+    27222,      // Life Tap (Rank 7)
+    57946,      // Life Tap (Rank 8)
+    29858,      // Soulshatter
+    55213       // Unholy Frenzy
+};
+
+// spell IDs that should never be modified
+// handles cases where a spell is reflecting damage or otherwise converting player damage to something else
+static std::list<uint32_t> const spellIdsToNeverModify =
+{
+    1177        // Twin Empathy (AQ40 Twin Emperors, only in `spell_dbc` database table)
+};
+
+std::list<uint32_t> ParseIntsFromString(std::string const& inputString) // Used when parsing strings that have comma delimited ints
+{
+    std::string delimitedValue;
+    std::stringstream intStringStream;
+    std::list<uint32_t> returnIntList;
+
+    intStringStream.str(inputString);
+    while (std::getline(intStringStream, delimitedValue, ',')) // Process each int in the string, delimited by the comma - ","
+    {
+        std::string valueOne;
+        std::stringstream intStream(delimitedValue);
+        intStream >>valueOne;
+        auto intValue = atoi(valueOne.c_str());
+        returnIntList.push_back(intValue);
+    }
+
+    return returnIntList;
+}
+
+std::map<uint32_t, uint8_t> LoadMinPlayersPerDungeonId(std::string const& minPlayersString) // Used for reading the string from the configuration file for per-dungeon minimum player count overrides
+{
+    std::string delimitedValue;
+    std::stringstream dungeonIdStream;
+    std::map<uint32_t, uint8_t> dungeonIdMap;
+
+    dungeonIdStream.str(minPlayersString);
+    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
+    {
+        std::string val1, val2;
+        std::stringstream dungeonPairStream(delimitedValue);
+        dungeonPairStream >> val1 >> val2;
+        auto dungeonMapId = atoi(val1.c_str());
+        auto minPlayers = atoi(val2.c_str());
+        dungeonIdMap[dungeonMapId] = minPlayers;
+    }
+
+    return dungeonIdMap;
+}
+
+std::map<uint32_t, DungeonScaleInflectionPointSettings> LoadInflectionPointOverrides(std::string const& dungeonIdString) // Used for reading the string from the configuration file for selecting dungeons to override
+{
+    std::string delimitedValue;
+    std::stringstream dungeonIdStream;
+    std::map<uint32_t, DungeonScaleInflectionPointSettings> overrideMap;
+
+    dungeonIdStream.str(dungeonIdString);
+    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
+    {
+        std::string val1, val2, val3, val4;
+        std::stringstream dungeonPairStream(delimitedValue);
+        dungeonPairStream >> val1 >> val2 >> val3 >> val4;
+
+        auto dungeonMapId = atoi(val1.c_str());
+
+        // Replace any missing values with -1
+        if (val2.empty()) { val2 = "-1"; }
+        if (val3.empty()) { val3 = "-1"; }
+        if (val4.empty()) { val4 = "-1"; }
+
+        DungeonScaleInflectionPointSettings ipSettings = DungeonScaleInflectionPointSettings(
+            atof(val2.c_str()),
+            atof(val3.c_str()),
+            atof(val4.c_str())
+        );
+
+        overrideMap[dungeonMapId] = ipSettings;
+    }
+
+    return overrideMap;
+}
+
+std::map<uint32_t, DungeonScaleStatModifiers> LoadStatModifierOverrides(std::string const& dungeonIdString) // Used for reading the string from the configuration file for per-dungeon stat modifiers
+{
+    std::string delimitedValue;
+    std::stringstream dungeonIdStream;
+    std::map<uint32_t, DungeonScaleStatModifiers> overrideMap;
+
+    dungeonIdStream.str(dungeonIdString);
+    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
+    {
+        std::string val1, val2, val3, val4, val5, val6, val7;
+        std::stringstream dungeonStream(delimitedValue);
+        dungeonStream >> val1 >> val2 >> val3 >> val4 >> val5 >> val6 >> val7;
+
+        auto dungeonMapId = atoi(val1.c_str());
+
+        // Replace any missing values with -1
+        if (val2.empty()) { val2 = "-1"; }
+        if (val3.empty()) { val3 = "-1"; }
+        if (val4.empty()) { val4 = "-1"; }
+        if (val5.empty()) { val5 = "-1"; }
+        if (val6.empty()) { val6 = "-1"; }
+        if (val7.empty()) { val7 = "-1"; }
+
+        DungeonScaleStatModifiers statSettings = DungeonScaleStatModifiers(
+            atof(val2.c_str()),
+            atof(val3.c_str()),
+            atof(val4.c_str()),
+            atof(val5.c_str()),
+            atof(val6.c_str()),
+            atof(val7.c_str())
+        );
+
+        overrideMap[dungeonMapId] = statSettings;
+    }
+
+    return overrideMap;
+}
+
+std::map<uint32_t, uint32_t> LoadDistanceCheckOverrides(std::string const& dungeonIdString)
+{
+    std::string delimitedValue;
+    std::stringstream dungeonIdStream;
+    std::map<uint32_t, uint32_t> overrideMap;
+
+    dungeonIdStream.str(dungeonIdString);
+    while (std::getline(dungeonIdStream, delimitedValue, ',')) // Process each dungeon ID in the string, delimited by the comma - "," and then space " "
+    {
+        std::string val1, val2;
+        std::stringstream dungeonStream(delimitedValue);
+        dungeonStream >> val1 >> val2;
+
+        auto dungeonMapId = atoi(val1.c_str());
+        overrideMap[dungeonMapId] = atoi(val2.c_str());
+    }
+
+    return overrideMap;
+}
+
+bool isIntInList(std::list<uint32_t> const& intList, uint32_t intValue)
+{
+    return (std::find(intList.begin(), intList.end(), intValue) != intList.end());
+}
+
+DungeonScaleInstanceType GetInstanceType(uint32_t maxPlayers, bool isHeroic)
+{
+    if (isHeroic)
+    {
+        if (maxPlayers <= 5)
+            return DUNGEONSCALE_INSTANCE_5M_HEROIC;
+        else if (maxPlayers <= 10)
+            return DUNGEONSCALE_INSTANCE_10M_HEROIC;
+        else if (maxPlayers <= 25)
+            return DUNGEONSCALE_INSTANCE_25M_HEROIC;
+        else
+            return DUNGEONSCALE_INSTANCE_OTHER_HEROIC;
+    }
+
+    if (maxPlayers <= 5)
+        return DUNGEONSCALE_INSTANCE_5M;
+    else if (maxPlayers <= 10)
+        return DUNGEONSCALE_INSTANCE_10M;
+    else if (maxPlayers <= 15)
+        return DUNGEONSCALE_INSTANCE_15M;
+    else if (maxPlayers <= 20)
+        return DUNGEONSCALE_INSTANCE_20M;
+    else if (maxPlayers <= 25)
+        return DUNGEONSCALE_INSTANCE_25M;
+    else if (maxPlayers <= 40)
+        return DUNGEONSCALE_INSTANCE_40M;
+    else
+        return DUNGEONSCALE_INSTANCE_OTHER_NORMAL;
+}
+
+char const* GetInstanceTypeName(DungeonScaleInstanceType instanceType)
+{
+    switch (instanceType)
+    {
+        case DUNGEONSCALE_INSTANCE_5M:              return "1 to 5 Player Normal";
+        case DUNGEONSCALE_INSTANCE_10M:             return "10 Player Normal";
+        case DUNGEONSCALE_INSTANCE_15M:             return "15 Player Normal";
+        case DUNGEONSCALE_INSTANCE_20M:             return "20 Player Normal";
+        case DUNGEONSCALE_INSTANCE_25M:             return "25 Player Normal";
+        case DUNGEONSCALE_INSTANCE_40M:             return "40 Player Normal";
+        case DUNGEONSCALE_INSTANCE_OTHER_NORMAL:    return "?? Player Normal";
+        case DUNGEONSCALE_INSTANCE_5M_HEROIC:       return "1 to 5 Player Heroic";
+        case DUNGEONSCALE_INSTANCE_10M_HEROIC:      return "10 Player Heroic";
+        case DUNGEONSCALE_INSTANCE_25M_HEROIC:      return "25 Player Heroic";
+        case DUNGEONSCALE_INSTANCE_OTHER_HEROIC:    return "?? Player Heroic";
+        default:                                    return "Unknown";
+    }
+}
+
+DungeonScaleStatModifiers const* FindCreatureStatModifierOverride(DungeonScaleEngineConfig const& config, uint32_t creatureId)
+{
+    auto creatureOverrideIterator = config.statModifierCreatureOverrides.find(creatureId);
+    if (creatureOverrideIterator == config.statModifierCreatureOverrides.end())
+        return nullptr;
+
+    return &creatureOverrideIterator->second;
+}
+
+DungeonScaleInflectionPointSettings CalculateInflectionPointSettings(DungeonScaleEngineConfig const& config, DungeonScaleMapDescriptor const& map, bool isBoss)
+{
+    DungeonScaleInflectionPointConfig const& inflectionPoint = config.inflectionPoints[GetInstanceType(map.maxPlayers, map.isHeroic)];
+
+    //
+    // Base Inflection Point
+    //
+    float inflectionValue = (float)map.maxPlayers * inflectionPoint.value;
+    float curveFloor = inflectionPoint.curveFloor;
+    float curveCeiling = inflectionPoint.curveCeiling;
+
+    // Per map ID overrides alter the above settings, if set
+    auto dungeonOverrideIterator = config.dungeonOverrides.find(map.mapId);
+    if (dungeonOverrideIterator != config.dungeonOverrides.end())
+    {
+        DungeonScaleInflectionPointSettings const& myInflectionPointOverrides = dungeonOverrideIterator->second;
+
+        // Alter the inflectionValue according to the override, if set
+        if (myInflectionPointOverrides.value != -1)
+        {
+            inflectionValue  = (float)map.maxPlayers; // Starting over
+            inflectionValue *= myInflectionPointOverrides.value;
+        }
+
+        if (myInflectionPointOverrides.curveFloor != -1)   { curveFloor =    myInflectionPointOverrides.curveFloor;   }
+        if (myInflectionPointOverrides.curveCeiling != -1) { curveCeiling =  myInflectionPointOverrides.curveCeiling; }
+    }
+
+    //
+    // Boss Inflection Point
+    //
+    if (isBoss)
+    {
+        // Per map ID overrides replace the value determined by the instance type, if set
+        auto bossOverrideIterator = config.bossOverrides.find(map.mapId);
+        if (bossOverrideIterator != config.bossOverrides.end() && bossOverrideIterator->second.value != -1)
+            inflectionValue *= bossOverrideIterator->second.value;
+        else
+            inflectionValue *= inflectionPoint.bossModifier;
+    }
+
+    return DungeonScaleInflectionPointSettings(inflectionValue, curveFloor, curveCeiling);
+}
+
+static void ApplyStatModifierOverrides(DungeonScaleStatModifiers& statModifiers, DungeonScaleStatModifiers const& overrides)
+{
+    if (overrides.global != -1)      { statModifiers.global =      overrides.global;      }
+    if (overrides.health != -1)      { statModifiers.health =      overrides.health;      }
+    if (overrides.mana != -1)        { statModifiers.mana =        overrides.mana;        }
+    if (overrides.armor != -1)       { statModifiers.armor =       overrides.armor;       }
+    if (overrides.damage != -1)      { statModifiers.damage =      overrides.damage;      }
+    if (overrides.ccduration != -1)  { statModifiers.ccduration =  overrides.ccduration;  }
+}
+
+DungeonScaleStatModifiers CalculateStatModifiers(DungeonScaleEngineConfig const& config, DungeonScaleMapDescriptor const& map, DungeonScaleCreatureDescriptor const* creature)
+{
+    DungeonScaleInstanceType instanceType = GetInstanceType(map.maxPlayers, map.isHeroic);
+    bool isBoss = creature && creature->isBoss;
+
+    // Apply the per-instance-type modifiers first
+    // DungeonScale.StatModifier*(.Boss).<stat>
+    DungeonScaleStatModifiers statModifiers = isBoss ? config.bossStatModifiers[instanceType] : config.statModifiers[instanceType];
+
+    // Per-Map Overrides
+    // DungeonScale.StatModifier.Boss.PerInstance
+    auto bossOverrideIterator = isBoss ? config.statModifierBossOverrides.find(map.mapId) : config.statModifierBossOverrides.end();
+    if (bossOverrideIterator != config.statModifierBossOverrides.end())
+    {
+        ApplyStatModifierOverrides(statModifiers, bossOverrideIterator->second);
+    }
+    // DungeonScale.StatModifier.PerInstance
+    else
+    {
+        auto overrideIterator = config.statModifierOverrides.find(map.mapId);
+        if (overrideIterator != config.statModifierOverrides.end())
+            ApplyStatModifierOverrides(statModifiers, overrideIterator->second);
+    }
+
+    // Per-creature modifiers applied last
+    // DungeonScale.StatModifier.PerCreature
+    if (creature && creature->creatureOverride)
+        ApplyStatModifierOverrides(statModifiers, *creature->creatureOverride);
+
+    return statModifiers;
+}
+
+float CalculateDefaultMultiplier(DungeonScaleMapDescriptor const& map, DungeonScaleInflectionPointSettings const& inflectionPointSettings)
+{
+    // You can visually see the effects of this function by using this spreadsheet:
+    // https://docs.google.com/spreadsheets/d/100cmKIJIjCZ-ncWd0K9ykO8KUgwFTcwg4h2nfE_UeCc/copy
+
+    float maxNumberOfPlayers = (float)map.maxPlayers;
+    float adjustedPlayerCount = map.adjustedPlayerCount;
+
+    // #maththings
+    float diff = (maxNumberOfPlayers/5)*1.5f;
+
+    // For math reasons that I do not understand, curveCeiling needs to be adjusted to bring the actual multiplier
+    // closer to the curveCeiling setting. Create an adjustment based on how much the ceiling should be changed at
+    // the max players multiplier.
+    float curveCeilingAdjustment =
+        inflectionPointSettings.curveCeiling /
+        (((tanh((maxNumberOfPlayers - inflectionPointSettings.value) / diff) + 1.0f) / 2.0f) *
+        (inflectionPointSettings.curveCeiling - inflectionPointSettings.curveFloor) + inflectionPointSettings.curveFloor);
+
+    // Adjust the multiplier based on the configured floor and ceiling values, plus the ceiling adjustment we just calculated
+    float defaultMultiplier =
+        ((tanh((adjustedPlayerCount - inflectionPointSettings.value) / diff) + 1.0f) / 2.0f) *
+        (inflectionPointSettings.curveCeiling * curveCeilingAdjustment - inflectionPointSettings.curveFloor) +
+        inflectionPointSettings.curveFloor;
+
+    return defaultMultiplier;
+}
+
+DungeonScaleCreatureMultipliers CalculateCreatureMultipliers(DungeonScaleEngineConfig const& config, float defaultMultiplier, DungeonScaleStatModifiers const& statModifiers, bool hasMana)
+{
+    DungeonScaleMultiplierLimits const& limits = config.multiplierLimits;
+    DungeonScaleCreatureMultipliers multipliers;
+
+    multipliers.health = std::max(defaultMultiplier * statModifiers.global * statModifiers.health, limits.minHealth);
+    multipliers.mana = hasMana ? std::max(defaultMultiplier * statModifiers.global * statModifiers.mana, limits.minMana) : 0.0f;
+    multipliers.armor = defaultMultiplier * statModifiers.global * statModifiers.armor;
+    multipliers.damage = std::max(defaultMultiplier * statModifiers.global * statModifiers.damage, limits.minDamage);
+
+    // -1 leaves the duration alone
+    if (statModifiers.ccduration != -1.0f)
+    {
+        float ccDuration = defaultMultiplier * statModifiers.ccduration;
+
+        if (ccDuration < limits.minCCDuration)
+            ccDuration = limits.minCCDuration;
+        else if (ccDuration > limits.maxCCDuration)
+            ccDuration = limits.maxCCDuration;
+
+        multipliers.ccDuration = ccDuration;
+    }
+
+    return multipliers;
+}
+
+uint8_t CalculateAdjustedPlayerCount(DungeonScaleEngineConfig const& config, uint8_t playerCount, uint8_t oldPlayerCount, uint8_t minPlayers,
+                                     uint8_t overridePlayerCount, bool combatLocked, uint8_t& combatLockMinPlayers)
+{
+    uint8_t adjustedPlayerCount = 0;
+
+    // if combat is locked and the new player count is higher than the combat lock, the new count is the new floor
+    if (combatLocked && playerCount > oldPlayerCount && playerCount > combatLockMinPlayers)
+    {
+        adjustedPlayerCount = playerCount;
+        combatLockMinPlayers = playerCount;
+    }
+    // if combat is otherwise locked, start with the saved floor
+    else if (combatLocked)
+    {
+        adjustedPlayerCount = combatLockMinPlayers ? combatLockMinPlayers : playerCount;
+    }
+    // if combat is not locked, start with the actual player count
+    else
+    {
+        adjustedPlayerCount = playerCount;
+    }
+
+    // if the adjusted player count is below the min players setting, adjust it
+    if (adjustedPlayerCount < minPlayers)
+        adjustedPlayerCount = minPlayers;
+
+    // adjust by the override, or the PlayerDifficultyOffset
+    if (overridePlayerCount > 0)
+        adjustedPlayerCount = overridePlayerCount;
+    else
+        adjustedPlayerCount += config.playerCountDifficultyOffset;
+
+    return adjustedPlayerCount;
+}
+
+uint32_t GetPlayerCountChangeDelay(DungeonScaleEngineConfig const& config, uint8_t newAdjustedPlayerCount, uint8_t oldAdjustedPlayerCount)
+{
+    return newAdjustedPlayerCount < oldAdjustedPlayerCount ? config.playerCountDecreaseDelay : config.playerCountIncreaseDelay;
+}
+
+// hold the current difficulty until a change has been stable for the configured delay, returns the player count to scale for now
+// overrides and the first calculation for the map (no old count) apply right away
+uint8_t ApplyPlayerCountChangeDelay(DungeonScaleEngineConfig const& config, uint8_t adjustedPlayerCount, uint8_t oldAdjustedPlayerCount, bool isOverridden,
+                                    uint64_t now, uint8_t& pendingAdjustedPlayerCount, uint64_t& pendingAdjustedPlayerCountTime)
+{
+    // back where it was (or overridden), nothing is pending anymore
+    if (adjustedPlayerCount == oldAdjustedPlayerCount || !oldAdjustedPlayerCount || isOverridden)
+    {
+        pendingAdjustedPlayerCount = 0;
+        return adjustedPlayerCount;
+    }
+
+    if (pendingAdjustedPlayerCount != adjustedPlayerCount)
+    {
+        pendingAdjustedPlayerCount = adjustedPlayerCount;
+        pendingAdjustedPlayerCountTime = now;
+    }
+
+    if (now - pendingAdjustedPlayerCountTime < GetPlayerCountChangeDelay(config, adjustedPlayerCount, oldAdjustedPlayerCount))
+        return oldAdjustedPlayerCount;
+
+    pendingAdjustedPlayerCount = 0;
+    return adjustedPlayerCount;
+}
+
+// a pending difficulty change may have become stable since the player count was last calculated
+bool IsPendingPlayerCountChangeDue(DungeonScaleEngineConfig const& config, uint8_t pendingAdjustedPlayerCount, uint8_t adjustedPlayerCount,
+                                   uint64_t pendingAdjustedPlayerCountTime, uint64_t now)
+{
+    if (!pendingAdjustedPlayerCount)
+        return false;
+
+    return now - pendingAdjustedPlayerCountTime >= GetPlayerCountChangeDelay(config, pendingAdjustedPlayerCount, adjustedPlayerCount);
+}
+
+bool IsSpellNeverModified(uint32_t spellId)
+{
+    return spellId && isIntInList(spellIdsToNeverModify, spellId);
+}
+
+bool IsSpellSpendingPlayerHealth(uint32_t spellId)
+{
+    return spellId && isIntInList(spellIdsThatSpendPlayerHealth, spellId);
+}
+
+DungeonScaleDamageHealingBranch ClassifyDamageHealing(DungeonScaleDamageHealingEvent const& event)
+{
+    //
+    // Pre-flight Checks
+    //
+
+    // if the spell ID is in our "never modify" list, return the original value
+    if (IsSpellNeverModified(event.spellId))
+        return DUNGEONSCALE_DAMAGE_HEALING_NEVER_MODIFY_SPELL;
+
+    // Any healing on a player should not be scaled
+    if (event.amount >= 0 && event.targetIsPlayer)
+        return DUNGEONSCALE_DAMAGE_HEALING_HEALING_PLAYER;
+
+    // if either the target or the source's maps are not enabled, return the original damage
+    if (!event.mapsEnabled)
+        return DUNGEONSCALE_DAMAGE_HEALING_MAP_NOT_ENABLED;
+
+    //
+    // Source and Target Checking
+    //
+
+    // if the source is a player and they are healing themselves, return the original value
+    if (event.sourceIsPlayer && event.isSelf && event.amount >= 0)
+    {
+        return DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_HEALING;
+    }
+    // if the source is a player and they are damaging themselves, continue unless the spell is one to ignore
+    else if (event.sourceIsPlayer && event.isSelf && event.amount < 0)
+    {
+        if (IsSpellSpendingPlayerHealth(event.spellId))
+            return DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SPENDING_HEALTH;
+    }
+    // if the source is a player and they are damaging unit that is friendly, continue
+    else if (event.sourceIsPlayer && event.targetIsFriendly && event.amount < 0)
+    {
+    }
+    // if the source is a player under any other condition, return the original value
+    else if (event.sourceIsPlayer)
+    {
+        return DUNGEONSCALE_DAMAGE_HEALING_ENEMY_PLAYER;
+    }
+    // if the creature is attacking itself with an aura with effect type SPELL_AURA_SHARE_DAMAGE_PCT, return the orginal damage
+    else if (event.sourceIsCreature && event.isSelf && event.isShareDamageAura)
+    {
+        return DUNGEONSCALE_DAMAGE_HEALING_CREATURE_SHARING_DAMAGE;
+    }
+
+    // if the source is under the control of the player, return the original damage
+    if (event.isPlayerControlled)
+        return DUNGEONSCALE_DAMAGE_HEALING_PLAYER_CONTROLLED;
+
+    //
+    // Multiplier selection
+    //
+
+    // if the source is a player AND the target is that same player AND the value is damage (negative), use the map's multiplier
+    if (event.sourceIsPlayer && event.isSelf && event.amount < 0)
+        return DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_DAMAGE;
+    // if the target is a player AND the value is healing (positive), use the map's damage multiplier
+    else if (event.targetIsPlayer && event.amount >= 0)
+        return DUNGEONSCALE_DAMAGE_HEALING_NON_PLAYER_HEALING_PLAYER;
+    // if the target is a player AND the source is not a creature, use the map's multiplier
+    else if (event.targetIsPlayer && !event.sourceIsCreature && event.amount < 0)
+        return DUNGEONSCALE_DAMAGE_HEALING_NON_CREATURE_DAMAGING_PLAYER;
+
+    // otherwise, use the source creature's damage multiplier
+    return DUNGEONSCALE_DAMAGE_HEALING_CREATURE_MULTIPLIER;
+}
+
+char const* GetDamageHealingBranchName(DungeonScaleDamageHealingBranch branch)
+{
+    switch (branch)
+    {
+        case DUNGEONSCALE_DAMAGE_HEALING_NEVER_MODIFY_SPELL:            return "Spell is in the never modify list";
+        case DUNGEONSCALE_DAMAGE_HEALING_HEALING_PLAYER:                return "Target is a player that is being healed";
+        case DUNGEONSCALE_DAMAGE_HEALING_MAP_NOT_ENABLED:               return "Source or Target's map is not enabled";
+        case DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_HEALING:           return "Source is a player that is self-healing";
+        case DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SPENDING_HEALTH:        return "Source is a player that is self-damaging with a spell that is ignored";
+        case DUNGEONSCALE_DAMAGE_HEALING_ENEMY_PLAYER:                  return "Source is an enemy player";
+        case DUNGEONSCALE_DAMAGE_HEALING_CREATURE_SHARING_DAMAGE:       return "Source is a creature that is self-damaging with an aura that shares damage";
+        case DUNGEONSCALE_DAMAGE_HEALING_PLAYER_CONTROLLED:             return "Source is a player-controlled pet or summon";
+        case DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_DAMAGE:            return "Source is a player and the target is that same player, using the map's (level-scaling ignored) multiplier";
+        case DUNGEONSCALE_DAMAGE_HEALING_NON_PLAYER_HEALING_PLAYER:     return "A non-player is healing a player, using the map's multiplier";
+        case DUNGEONSCALE_DAMAGE_HEALING_NON_CREATURE_DAMAGING_PLAYER:  return "Target is a player and the source is not a creature, using the map's (level-scaling-ignored) multiplier";
+        case DUNGEONSCALE_DAMAGE_HEALING_CREATURE_MULTIPLIER:           return "Using the source creature's damage multiplier";
+        default:                                                        return "Unknown";
+    }
+}
+
+bool IsLootItemExemptFromScaling(DungeonScaleEngineConfig const& config, DungeonScaleLootItemDescriptor const& item)
+{
+    // Nothing if there is no scaling loot at play
+    if (!config.rewardScalingLoot)
+        return true;
+
+    // Enchanting materials not subjected to item scaling
+    if (item.isEnchantingMaterial)
+        return true;
+
+    // Duration (items that expire) are always exempted
+    if (item.expires)
+        return true;
+
+    // Always return the loot if it's a BOP drop and configured to do so
+    if (config.rewardScalingLootBOPAlwaysDropException && item.isBindOnPickup)
+        return true;
+
+    // Skip if exception itemID
+    if (isIntInList(config.rewardScalingExceptionItemIDs, item.itemId))
+        return true;
+
+    // If exempted, don't scale items from chests or gather points
+    if (config.rewardScalingExemptContainers && item.isFromContainer)
+        return true;
+
+    // If exempted, don't scale items from skinning
+    if (config.rewardScalingExemptSkinning && item.isLeather)
+        return true;
+
+    return false;
+}
+
+// randomPick is a uniform roll from 1 to the map's max players
+bool IsScaledLootRollKept(DungeonScaleMapDescriptor const& map, uint32_t randomPick)
+{
+    return randomPick <= map.adjustedPlayerCount;
+}
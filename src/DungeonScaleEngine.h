@@ -0,0 +1,368 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Scaling engine for DungeonScale
+*
+* The scaling math and decisions, with plain-data inputs and outputs (map descriptor, creature descriptor,
+* config snapshot -> multipliers). Nothing in here may depend on AzerothCore, so it builds on its own:
+*
+*   g++ -std=c++20 -O2 -Wall -Wextra -c src/DungeonScaleEngine.cpp
+*
+* DungeonScale.cpp reads the config into a DungeonScaleEngineConfig and describes maps and creatures to it.
+*/
+
+#ifndef MOD_DUNGEONSCALE_ENGINE_H
+#define MOD_DUNGEONSCALE_ENGINE_H
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+
+// instance categories that have their own inflection point and stat modifier settings
+enum DungeonScaleInstanceType : uint8_t
+{
+    DUNGEONSCALE_INSTANCE_5M = 0,                   // DungeonScale.InflectionPoint, DungeonScale.StatModifier
+    DUNGEONSCALE_INSTANCE_10M,                      // DungeonScale.InflectionPointRaid10M, DungeonScale.StatModifierRaid10M
+    DUNGEONSCALE_INSTANCE_15M,
+    DUNGEONSCALE_INSTANCE_20M,
+    DUNGEONSCALE_INSTANCE_25M,
+    DUNGEONSCALE_INSTANCE_40M,
+    DUNGEONSCALE_INSTANCE_OTHER_NORMAL,             // DungeonScale.InflectionPointRaid, DungeonScale.StatModifierRaid
+    DUNGEONSCALE_INSTANCE_5M_HEROIC,                // DungeonScale.InflectionPointHeroic, DungeonScale.StatModifierHeroic
+    DUNGEONSCALE_INSTANCE_10M_HEROIC,
+    DUNGEONSCALE_INSTANCE_25M_HEROIC,
+    DUNGEONSCALE_INSTANCE_OTHER_HEROIC,             // DungeonScale.InflectionPointRaidHeroic, DungeonScale.StatModifierRaidHeroic
+    DUNGEONSCALE_INSTANCE_TYPE_COUNT
+};
+
+// in per-instance and per-creature overrides, -1 means "not overridden"
+class DungeonScaleStatModifiers
+{
+public:
+    DungeonScaleStatModifiers() {}
+    DungeonScaleStatModifiers(float global, float health, float mana, float armor, float damage, float ccduration) :
+        global(global), health(health), mana(mana), armor(armor), damage(damage), ccduration(ccduration) {}
+    float global = 1.0f;
+    float health = 1.0f;
+    float mana = 1.0f;
+    float armor = 1.0f;
+    float damage = 1.0f;
+    float ccduration = -1.0f;
+};
+
+class DungeonScaleInflectionPointSettings
+{
+public:
+    DungeonScaleInflectionPointSettings() {}
+    DungeonScaleInflectionPointSettings(float value, float curveFloor, float curveCeiling) :
+        value(value), curveFloor(curveFloor), curveCeiling(curveCeiling) {}
+    float value = -1.0f;
+    float curveFloor = -1.0f;
+    float curveCeiling = -1.0f;
+};
+
+// DungeonScale.InflectionPoint*(.CurveFloor|.CurveCeiling|.BossModifier) for one instance category
+class DungeonScaleInflectionPointConfig
+{
+public:
+    float value = 0.5f;                             // fraction of the max players at which the curve is halfway
+    float curveFloor = 0.0f;
+    float curveCeiling = 1.0f;
+    float bossModifier = 1.0f;                      // applied on top of value for bosses
+};
+
+// DungeonScale.MinHPModifier, .MinManaModifier, .MinDamageModifier, .MinCCDurationModifier and .MaxCCDurationModifier
+class DungeonScaleMultiplierLimits
+{
+public:
+    float minHealth = 0.1f;
+    float minMana = 0.01f;
+    float minDamage = 0.01f;
+    float minCCDuration = 0.25f;
+    float maxCCDuration = 1.0f;
+};
+
+// what a creature's original stats are multiplied by
+class DungeonScaleCreatureMultipliers
+{
+public:
+    float health = 1.0f;
+    float mana = 1.0f;                              // 0 for creatures without mana
+    float armor = 1.0f;
+    float damage = 1.0f;
+    float ccDuration = 1.0f;
+};
+
+// everything the engine needs from the config, read once per config (re)load
+class DungeonScaleEngineConfig
+{
+public:
+    DungeonScaleInflectionPointConfig inflectionPoints[DUNGEONSCALE_INSTANCE_TYPE_COUNT];
+    DungeonScaleStatModifiers statModifiers[DUNGEONSCALE_INSTANCE_TYPE_COUNT];
+    DungeonScaleStatModifiers bossStatModifiers[DUNGEONSCALE_INSTANCE_TYPE_COUNT];
+
+    std::map<uint32_t, DungeonScaleInflectionPointSettings> dungeonOverrides;       // DungeonScale.InflectionPoint.PerInstance
+    std::map<uint32_t, DungeonScaleInflectionPointSettings> bossOverrides;          // DungeonScale.InflectionPoint.Boss.PerInstance
+    std::map<uint32_t, DungeonScaleStatModifiers> statModifierOverrides;            // DungeonScale.StatModifier.PerInstance
+    std::map<uint32_t, DungeonScaleStatModifiers> statModifierBossOverrides;        // DungeonScale.StatModifier.Boss.PerInstance
+    std::map<uint32_t, DungeonScaleStatModifiers> statModifierCreatureOverrides;    // DungeonScale.StatModifier.PerCreature
+
+    DungeonScaleMultiplierLimits multiplierLimits;
+
+    int8_t playerCountDifficultyOffset = 0;
+    uint32_t playerCountDecreaseDelay = 5000;       // DungeonScale.PlayerCount.DecreaseDelay, in milliseconds
+    uint32_t playerCountIncreaseDelay = 0;          // DungeonScale.PlayerCount.IncreaseDelay, in milliseconds
+
+    bool rewardScalingLoot = true;
+    bool rewardScalingLootBOPAlwaysDropException = true;
+    bool rewardScalingExemptContainers = true;
+    bool rewardScalingExemptSkinning = true;
+    std::list<uint32_t> rewardScalingExceptionItemIDs;
+};
+
+// the parts of an instance map that scaling depends on
+class DungeonScaleMapDescriptor
+{
+public:
+    uint32_t mapId = 0;
+    uint32_t maxPlayers = 5;
+    bool isHeroic = false;
+    uint8_t adjustedPlayerCount = 1;                // the player count the map is currently scaled for
+};
+
+// the parts of a creature that its stat modifiers depend on
+class DungeonScaleCreatureDescriptor
+{
+public:
+    uint32_t entry = 0;
+    bool isBoss = false;                            // boss, or summoned by one
+    DungeonScaleStatModifiers const* creatureOverride = nullptr;    // resolved by the caller, see FindCreatureStatModifierOverride
+};
+
+// the parts of an item roll that the loot exemptions depend on
+class DungeonScaleLootItemDescriptor
+{
+public:
+    uint32_t itemId = 0;
+    bool isEnchantingMaterial = false;
+    bool isLeather = false;                         // skinning result
+    bool expires = false;                           // has a duration
+    bool isBindOnPickup = false;
+    bool isFromContainer = false;                   // chest or fishing node
+};
+
+// how the multiplier for a unit damaging or healing another unit is decided, in the order the checks are made
+enum DungeonScaleDamageHealingBranch : uint8_t
+{
+    // the original amount is kept
+    DUNGEONSCALE_DAMAGE_HEALING_NEVER_MODIFY_SPELL = 0,
+    DUNGEONSCALE_DAMAGE_HEALING_HEALING_PLAYER,
+    DUNGEONSCALE_DAMAGE_HEALING_MAP_NOT_ENABLED,
+    DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_HEALING,
+    DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SPENDING_HEALTH,
+    DUNGEONSCALE_DAMAGE_HEALING_ENEMY_PLAYER,
+    DUNGEONSCALE_DAMAGE_HEALING_CREATURE_SHARING_DAMAGE,
+    DUNGEONSCALE_DAMAGE_HEALING_PLAYER_CONTROLLED,
+
+    // the amount is multiplied
+    DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_DAMAGE,             // source map's world damage/healing multiplier
+    DUNGEONSCALE_DAMAGE_HEALING_NON_PLAYER_HEALING_PLAYER,      // target map's world damage/healing multiplier
+    DUNGEONSCALE_DAMAGE_HEALING_NON_CREATURE_DAMAGING_PLAYER,   // target map's world damage/healing multiplier
+    DUNGEONSCALE_DAMAGE_HEALING_CREATURE_MULTIPLIER,            // source creature's damage multiplier
+
+    DUNGEONSCALE_DAMAGE_HEALING_BRANCH_COUNT
+};
+
+// a unit damaging (negative amount) or healing (positive amount) another unit in an instance
+class DungeonScaleDamageHealingEvent
+{
+public:
+    int32_t amount = 0;
+    uint32_t spellId = 0;                           // 0 for melee
+    bool sourceIsPlayer = false;
+    bool sourceIsCreature = false;                  // any non-player unit, including pets
+    bool targetIsPlayer = false;
+    bool isSelf = false;                            // source and target are the same unit
+    bool mapsEnabled = true;                        // both the source's and the target's maps are enabled
+    bool isPlayerControlled = false;                // source is a player-controlled pet or summon (not mind control)
+
+    // these are expensive to find out, and only need to be set when the decision depends on them
+    bool targetIsFriendly = false;                  // only for a player damaging another unit
+    bool isShareDamageAura = false;                 // only for a creature damaging itself with a spell
+};
+
+// Config parsers
+std::list<uint32_t> ParseIntsFromString(std::string const& inputString);
+std::map<uint32_t, uint8_t> LoadMinPlayersPerDungeonId(std::string const& minPlayersString);
+std::map<uint32_t, DungeonScaleInflectionPointSettings> LoadInflectionPointOverrides(std::string const& dungeonIdString);
+std::map<uint32_t, DungeonScaleStatModifiers> LoadStatModifierOverrides(std::string const& dungeonIdString);
+std::map<uint32_t, uint32_t> LoadDistanceCheckOverrides(std::string const& dungeonIdString);
+
+bool isIntInList(std::list<uint32_t> const& intList, uint32_t intValue);
+
+// Scaling
+DungeonScaleInstanceType GetInstanceType(uint32_t maxPlayers, bool isHeroic);
+char const* GetInstanceTypeName(DungeonScaleInstanceType instanceType);
+
+DungeonScaleStatModifiers const* FindCreatureStatModifierOverride(DungeonScaleEngineConfig const& config, uint32_t creatureId);
+
+DungeonScaleInflectionPointSettings CalculateInflectionPointSettings(DungeonScaleEngineConfig const& config, DungeonScaleMapDescriptor const& map, bool isBoss = false);
+DungeonScaleStatModifiers CalculateStatModifiers(DungeonScaleEngineConfig const& config, DungeonScaleMapDescriptor const& map, DungeonScaleCreatureDescriptor const* creature = nullptr);
+float CalculateDefaultMultiplier(DungeonScaleMapDescriptor const& map, DungeonScaleInflectionPointSettings const& inflectionPointSettings);
+DungeonScaleCreatureMultipliers CalculateCreatureMultipliers(DungeonScaleEngineConfig const& config, float defaultMultiplier, DungeonScaleStatModifiers const& statModifiers, bool hasMana);
+
+// Player count
+uint8_t CalculateAdjustedPlayerCount(DungeonScaleEngineConfig const& config, uint8_t playerCount, uint8_t oldPlayerCount, uint8_t minPlayers,
+                                     uint8_t overridePlayerCount, bool combatLocked, uint8_t& combatLockMinPlayers);
+uint32_t GetPlayerCountChangeDelay(DungeonScaleEngineConfig const& config, uint8_t newAdjustedPlayerCount, uint8_t oldAdjustedPlayerCount);
+uint8_t ApplyPlayerCountChangeDelay(DungeonScaleEngineConfig const& config, uint8_t adjustedPlayerCount, uint8_t oldAdjustedPlayerCount, bool isOverridden,
+                                    uint64_t now, uint8_t& pendingAdjustedPlayerCount, uint64_t& pendingAdjustedPlayerCountTime);
+bool IsPendingPlayerCountChangeDue(DungeonScaleEngineConfig const& config, uint8_t pendingAdjustedPlayerCount, uint8_t adjustedPlayerCount,
+                                   uint64_t pendingAdjustedPlayerCountTime, uint64_t now);
+
+// Damage and healing
+bool IsSpellNeverModified(uint32_t spellId);
+bool IsSpellSpendingPlayerHealth(uint32_t spellId);
+
+DungeonScaleDamageHealingBranch ClassifyDamageHealing(DungeonScaleDamageHealingEvent const& event);
+char const* GetDamageHealingBranchName(DungeonScaleDamageHealingBranch branch);
+
+// The body of the damage/healing hooks, from the early-outs to the multiplied amount, so that the module and the
+// stress harness run the same code. `units` adapts the caller's unit, spell and map info types:
+//
+//   bool IsEnabled()                               the module is enabled
+//   bool IsDungeon(Unit*), bool IsInWorld(Unit*)
+//   bool IsPlayer(Unit*), bool IsCreature(Unit*)   creature is any non-player unit, including pets
+//   bool IsSameUnit(Unit*, Unit*)
+//   bool IsPlayerControlled(Unit*)                 a player's pet or summon, not a mind controlled unit
+//   bool IsFriendlyTo(Unit* target, Unit* source)
+//   bool IsShareDamageAura(Spell const*)
+//   uint32_t GetSpellId(Spell const*)              0 for melee (nullptr)
+//   MapInfo* GetMapInfo(Unit*)                     the unit's map's info, with `enabled` and `worldDamageHealingMultiplier`
+//   float GetDamageMultiplier(Unit*)               the source creature's damage multiplier
+//
+// and is told what happens along the way:
+//
+//   OnEarlyOut(char const* reason, int32_t amount) left before the decision, the amount is unchanged
+//   OnSourceMissing()                              the target stands in for a source that is gone
+//   OnStart(Unit* source, uint32_t spellId, int32_t amount)
+//   OnDecided(Unit* source, MapInfo* sourceMapInfo, DungeonScaleDamageHealingEvent const&, DungeonScaleDamageHealingBranch,
+//             float multiplier, int32_t result)   sourceMapInfo is null for healing on a player, decided before the lookup
+template <class Units, class Unit, class Spell>
+int32_t ModifyDamageHealing(Units& units, Unit* target, Unit* source, int32_t amount, Spell const* spellInfo)
+{
+    if (!units.IsEnabled())
+    {
+        units.OnEarlyOut("EnableGlobal is false", amount);
+        return amount;
+    }
+
+    // if the source is gone (logged off? despawned?), use the same target and source.
+    // hacky, but better than crashing or having the damage go to 1.0x
+    if (!source)
+    {
+        units.OnSourceMissing();
+        source = target;
+    }
+
+    uint32_t spellId = units.GetSpellId(spellInfo);
+    units.OnStart(source, spellId, amount);
+
+    // make sure the source and target are in an instance, else return the original damage
+    // this is every event outside of instances, so it isn't reported
+    if (!(units.IsDungeon(source) && units.IsDungeon(target)))
+        return amount;
+
+    if (!units.IsInWorld(source))
+    {
+        units.OnEarlyOut("Source does not exist in the world", amount);
+        return amount;
+    }
+
+    // Any healing on a player should not be scaled
+    // this is most of the calls during a fight, so it is decided before looking up the maps' info
+    if (amount >= 0 && units.IsPlayer(target))
+    {
+        DungeonScaleDamageHealingEvent healingEvent;
+        healingEvent.amount = amount;
+        healingEvent.spellId = spellId;
+        units.OnDecided(source, nullptr, healingEvent, DUNGEONSCALE_DAMAGE_HEALING_HEALING_PLAYER, 1.0f, amount);
+
+        return amount;
+    }
+
+    // get the maps' info
+    auto* sourceMapInfo = units.GetMapInfo(source);
+    auto* targetMapInfo = units.GetMapInfo(target);
+
+    // describe the event to the scaling engine
+    DungeonScaleDamageHealingEvent damageHealingEvent;
+    damageHealingEvent.amount = amount;
+    damageHealingEvent.spellId = spellId;
+    damageHealingEvent.sourceIsPlayer = units.IsPlayer(source);
+    damageHealingEvent.sourceIsCreature = units.IsCreature(source);
+    damageHealingEvent.targetIsPlayer = units.IsPlayer(target);
+    damageHealingEvent.isSelf = units.IsSameUnit(source, target);
+    damageHealingEvent.mapsEnabled = sourceMapInfo->enabled && targetMapInfo->enabled;
+    damageHealingEvent.isPlayerControlled = units.IsPlayerControlled(source);
+
+    // only check what the decision can depend on
+    if (damageHealingEvent.sourceIsPlayer && !damageHealingEvent.isSelf)
+        damageHealingEvent.targetIsFriendly = units.IsFriendlyTo(target, source);
+
+    if (damageHealingEvent.sourceIsCreature && damageHealingEvent.isSelf)
+        damageHealingEvent.isShareDamageAura = units.IsShareDamageAura(spellInfo);
+
+    DungeonScaleDamageHealingBranch branch = ClassifyDamageHealing(damageHealingEvent);
+
+    float multiplier = 1.0f;
+
+    switch (branch)
+    {
+        case DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_DAMAGE:
+            multiplier = sourceMapInfo->worldDamageHealingMultiplier;
+            break;
+        case DUNGEONSCALE_DAMAGE_HEALING_NON_PLAYER_HEALING_PLAYER:
+        case DUNGEONSCALE_DAMAGE_HEALING_NON_CREATURE_DAMAGING_PLAYER:
+            multiplier = targetMapInfo->worldDamageHealingMultiplier;
+            break;
+        case DUNGEONSCALE_DAMAGE_HEALING_CREATURE_MULTIPLIER:
+            multiplier = units.GetDamageMultiplier(source);
+            break;
+        default:
+            units.OnDecided(source, sourceMapInfo, damageHealingEvent, branch, multiplier, amount);
+            return amount;
+    }
+
+    int32_t modifiedAmount = (int32_t)(amount * multiplier);
+    units.OnDecided(source, sourceMapInfo, damageHealingEvent, branch, multiplier, modifiedAmount);
+
+    return modifiedAmount;
+}
+
+// Loot
+bool IsLootItemExemptFromScaling(DungeonScaleEngineConfig const& config, DungeonScaleLootItemDescriptor const& item);
+bool IsScaledLootRollKept(DungeonScaleMapDescriptor const& map, uint32_t randomPick);
+
+#endif
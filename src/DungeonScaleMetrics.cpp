@@ -0,0 +1,189 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DungeonScaleMetrics.h"
+#include "DungeonScalePerf.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+static std::thread metricsThread;
+static std::mutex metricsLock;
+static std::condition_variable metricsWakeUp;
+static bool metricsStopping = false;
+
+static std::atomic<uint64_t> configReloadNs{0};
+
+// label values for the instance categories
+static char const* const metricsInstanceTypeLabels[DUNGEONSCALE_INSTANCE_TYPE_COUNT] =
+{
+    "5m",
+    "10m",
+    "15m",
+    "20m",
+    "25m",
+    "40m",
+    "other",
+    "5m_heroic",
+    "10m_heroic",
+    "25m_heroic",
+    "other_heroic"
+};
+
+void SetMetricsConfigReloadDuration(uint64_t ns)
+{
+    configReloadNs.store(ns, std::memory_order_relaxed);
+}
+
+static DungeonScalePerfHookStats GetHookStatsDelta(DungeonScalePerfHookStats const& current, DungeonScalePerfHookStats const& previous)
+{
+    DungeonScalePerfHookStats delta;
+    delta.calls = current.calls - previous.calls;
+    delta.sampledCalls = current.sampledCalls - previous.sampledCalls;
+    delta.sampledNs = current.sampledNs - previous.sampledNs;
+
+    for (uint8_t bucket = 0; bucket < DUNGEONSCALE_PERF_BUCKET_COUNT; ++bucket)
+        delta.buckets[bucket] = current.buckets[bucket] - previous.buckets[bucket];
+
+    return delta;
+}
+
+static void WriteMetrics(FILE* file, DungeonScalePerfSnapshot const& snapshot, DungeonScalePerfSnapshot const& previous, double intervalSeconds)
+{
+    // instances and creatures
+    fprintf(file, "# HELP dungeonscale_enabled_instances Instances that DungeonScale is scaling, by category.\n");
+    fprintf(file, "# TYPE dungeonscale_enabled_instances gauge\n");
+    for (uint8_t instanceType = 0; instanceType < DUNGEONSCALE_INSTANCE_TYPE_COUNT; ++instanceType)
+    {
+        fprintf(file, "dungeonscale_enabled_instances{category=\"%s\"} %lld\n",
+            metricsInstanceTypeLabels[instanceType],
+            (long long)snapshot.gauges[DUNGEONSCALE_PERF_GAUGE_ENABLED_INSTANCES + instanceType]
+        );
+    }
+
+    fprintf(file, "# HELP dungeonscale_creatures Creatures in instance creature lists (tracked) and included in the map stats (active).\n");
+    fprintf(file, "# TYPE dungeonscale_creatures gauge\n");
+    fprintf(file, "dungeonscale_creatures{state=\"tracked\"} %lld\n", (long long)snapshot.gauges[DUNGEONSCALE_PERF_GAUGE_TRACKED_CREATURES]);
+    fprintf(file, "dungeonscale_creatures{state=\"active\"} %lld\n", (long long)snapshot.gauges[DUNGEONSCALE_PERF_GAUGE_ACTIVE_CREATURES]);
+
+    fprintf(file, "# HELP dungeonscale_combat_locked_maps Instances whose difficulty is currently combat locked.\n");
+    fprintf(file, "# TYPE dungeonscale_combat_locked_maps gauge\n");
+    fprintf(file, "dungeonscale_combat_locked_maps %lld\n", (long long)snapshot.gauges[DUNGEONSCALE_PERF_GAUGE_COMBAT_LOCKED_MAPS]);
+
+    // rescales
+    int64_t rescales = snapshot.gauges[DUNGEONSCALE_PERF_GAUGE_RESCALES];
+    fprintf(file, "# HELP dungeonscale_rescales_total Creature rescales since startup.\n");
+    fprintf(file, "# TYPE dungeonscale_rescales_total counter\n");
+    fprintf(file, "dungeonscale_rescales_total %lld\n", (long long)rescales);
+    fprintf(file, "# HELP dungeonscale_rescales_per_second Creature rescales per second over the last export interval.\n");
+    fprintf(file, "# TYPE dungeonscale_rescales_per_second gauge\n");
+    fprintf(file, "dungeonscale_rescales_per_second %.3f\n", (rescales - previous.gauges[DUNGEONSCALE_PERF_GAUGE_RESCALES]) / intervalSeconds);
+
+    // hooks
+    fprintf(file, "# HELP dungeonscale_hook_calls_total Calls to the hook since startup.\n");
+    fprintf(file, "# TYPE dungeonscale_hook_calls_total counter\n");
+    for (uint8_t hook = 0; hook < DUNGEONSCALE_PERF_HOOK_COUNT; ++hook)
+        fprintf(file, "dungeonscale_hook_calls_total{hook=\"%s\"} %llu\n", GetPerfHookName((DungeonScalePerfHook)hook), (unsigned long long)snapshot.hooks[hook].calls);
+
+    fprintf(file, "# HELP dungeonscale_hook_calls_per_second Calls to the hook per second over the last export interval.\n");
+    fprintf(file, "# TYPE dungeonscale_hook_calls_per_second gauge\n");
+    for (uint8_t hook = 0; hook < DUNGEONSCALE_PERF_HOOK_COUNT; ++hook)
+    {
+        fprintf(file, "dungeonscale_hook_calls_per_second{hook=\"%s\"} %.3f\n",
+            GetPerfHookName((DungeonScalePerfHook)hook),
+            (snapshot.hooks[hook].calls - previous.hooks[hook].calls) / intervalSeconds
+        );
+    }
+
+    // quantiles are bucket upper bounds over the last export interval, sum and count cover the sampled calls since startup
+    fprintf(file, "# HELP dungeonscale_hook_latency_seconds Latency of the sampled hook calls.\n");
+    fprintf(file, "# TYPE dungeonscale_hook_latency_seconds summary\n");
+    for (uint8_t hook = 0; hook < DUNGEONSCALE_PERF_HOOK_COUNT; ++hook)
+    {
+        char const* hookName = GetPerfHookName((DungeonScalePerfHook)hook);
+        DungeonScalePerfHookStats delta = GetHookStatsDelta(snapshot.hooks[hook], previous.hooks[hook]);
+
+        for (double quantile : { 0.5, 0.9, 0.99 })
+            fprintf(file, "dungeonscale_hook_latency_seconds{hook=\"%s\",quantile=\"%g\"} %.9f\n", hookName, quantile, delta.GetQuantileNs(quantile) / 1e9);
+
+        fprintf(file, "dungeonscale_hook_latency_seconds_sum{hook=\"%s\"} %.9f\n", hookName, snapshot.hooks[hook].sampledNs / 1e9);
+        fprintf(file, "dungeonscale_hook_latency_seconds_count{hook=\"%s\"} %llu\n", hookName, (unsigned long long)snapshot.hooks[hook].sampledCalls);
+    }
+
+    // config
+    fprintf(file, "# HELP dungeonscale_config_reload_duration_seconds How long the last config (re)load took.\n");
+    fprintf(file, "# TYPE dungeonscale_config_reload_duration_seconds gauge\n");
+    fprintf(file, "dungeonscale_config_reload_duration_seconds %.9f\n", configReloadNs.load(std::memory_order_relaxed) / 1e9);
+}
+
+static void RunMetricsExport(std::string path, uint32_t intervalSeconds)
+{
+    std::string temporaryPath = path + ".tmp";
+
+    DungeonScalePerfSnapshot previous = GetPerfSnapshot(false);
+    std::chrono::steady_clock::time_point previousTime = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> guard(metricsLock);
+
+    while (!metricsWakeUp.wait_for(guard, std::chrono::seconds(intervalSeconds), []() { return metricsStopping; }))
+    {
+        DungeonScalePerfSnapshot snapshot = GetPerfSnapshot(false);
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        double elapsedSeconds = std::max(std::chrono::duration<double>(now - previousTime).count(), 0.001);
+
+        // a failed write is retried on the next interval
+        if (FILE* file = fopen(temporaryPath.c_str(), "w"))
+        {
+            WriteMetrics(file, snapshot, previous, elapsedSeconds);
+
+            if (fclose(file) == 0)
+                std::rename(temporaryPath.c_str(), path.c_str());
+        }
+
+        previous = snapshot;
+        previousTime = now;
+    }
+}
+
+void StartMetricsExport(std::string const& path, uint32_t intervalSeconds)
+{
+    StopMetricsExport();
+
+    metricsStopping = false;
+    metricsThread = std::thread(RunMetricsExport, path, std::max<uint32_t>(1, intervalSeconds));
+}
+
+void StopMetricsExport()
+{
+    if (!metricsThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(metricsLock);
+        metricsStopping = true;
+    }
+
+    metricsWakeUp.notify_all();
+    metricsThread.join();
+}
@@ -0,0 +1,45 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Prometheus metrics export for DungeonScale
+*
+* A background thread writes the server-wide metrics to a local file in the Prometheus text exposition format every
+* `DungeonScale.Metrics.Interval` seconds, for node_exporter's textfile collector or anything else that scrapes
+* files. It only reads the per-thread counters published by DungeonScalePerf, so it never waits on a map thread.
+* The file is written next to its final name and renamed over it, so readers never see a partial file.
+*/
+
+#ifndef MOD_DUNGEONSCALE_METRICS_H
+#define MOD_DUNGEONSCALE_METRICS_H
+
+#include <cstdint>
+#include <string>
+
+// (re)starts the export thread with the given settings, stopping the previous one first
+void StartMetricsExport(std::string const& path, uint32_t intervalSeconds);
+void StopMetricsExport();
+
+// how long the last config (re)load took
+void SetMetricsConfigReloadDuration(uint64_t ns);
+
+#endif
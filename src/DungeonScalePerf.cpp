@@ -0,0 +1,147 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DungeonScalePerf.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<uint32_t> perfSampleInterval{64};
+thread_local DungeonScalePerfThreadCounters* perfThreadCounters = nullptr;
+
+// counters outlive their threads, so nothing recorded is lost when a map thread exits
+static std::mutex perfThreadsLock;
+static std::vector<std::unique_ptr<DungeonScalePerfThreadCounters>> perfThreads;
+
+// resetting subtracts a baseline instead of writing other threads' counters
+static DungeonScalePerfSnapshot perfBaseline;
+static std::chrono::steady_clock::time_point perfBaselineTime = std::chrono::steady_clock::now();
+
+DungeonScalePerfThreadCounters* RegisterPerfThread()
+{
+    std::lock_guard<std::mutex> guard(perfThreadsLock);
+
+    perfThreads.push_back(std::make_unique<DungeonScalePerfThreadCounters>());
+    perfThreadCounters = perfThreads.back().get();
+
+    return perfThreadCounters;
+}
+
+static DungeonScalePerfSnapshot SumPerfCounters()
+{
+    DungeonScalePerfSnapshot snapshot;
+    snapshot.threadCount = perfThreads.size();
+
+    for (std::unique_ptr<DungeonScalePerfThreadCounters> const& counters : perfThreads)
+    {
+        for (uint8_t hook = 0; hook < DUNGEONSCALE_PERF_HOOK_COUNT; ++hook)
+        {
+            DungeonScalePerfHookStats& hookStats = snapshot.hooks[hook];
+            hookStats.calls += counters->calls[hook].load(std::memory_order_relaxed);
+            hookStats.sampledCalls += counters->sampledCalls[hook].load(std::memory_order_relaxed);
+            hookStats.sampledNs += counters->sampledNs[hook].load(std::memory_order_relaxed);
+
+            for (uint8_t bucket = 0; bucket < DUNGEONSCALE_PERF_BUCKET_COUNT; ++bucket)
+                hookStats.buckets[bucket] += counters->buckets[hook][bucket].load(std::memory_order_relaxed);
+        }
+
+        for (uint8_t gauge = 0; gauge < DUNGEONSCALE_PERF_GAUGE_COUNT; ++gauge)
+            snapshot.gauges[gauge] += counters->gauges[gauge].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+DungeonScalePerfSnapshot GetPerfSnapshot(bool sinceReset)
+{
+    std::lock_guard<std::mutex> guard(perfThreadsLock);
+
+    DungeonScalePerfSnapshot snapshot = SumPerfCounters();
+    if (!sinceReset)
+        return snapshot;
+
+    snapshot.elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - perfBaselineTime).count();
+
+    for (uint8_t hook = 0; hook < DUNGEONSCALE_PERF_HOOK_COUNT; ++hook)
+    {
+        DungeonScalePerfHookStats& hookStats = snapshot.hooks[hook];
+        DungeonScalePerfHookStats const& baseline = perfBaseline.hooks[hook];
+
+        hookStats.calls -= baseline.calls;
+        hookStats.sampledCalls -= baseline.sampledCalls;
+        hookStats.sampledNs -= baseline.sampledNs;
+
+        for (uint8_t bucket = 0; bucket < DUNGEONSCALE_PERF_BUCKET_COUNT; ++bucket)
+            hookStats.buckets[bucket] -= baseline.buckets[bucket];
+    }
+
+    return snapshot;
+}
+
+void ResetPerfCounters()
+{
+    std::lock_guard<std::mutex> guard(perfThreadsLock);
+
+    perfBaseline = SumPerfCounters();
+    perfBaselineTime = std::chrono::steady_clock::now();
+}
+
+uint64_t DungeonScalePerfHookStats::GetQuantileNs(double quantile) const
+{
+    uint64_t sampled = 0;
+    for (uint64_t bucketCount : buckets)
+        sampled += bucketCount;
+
+    if (!sampled)
+        return 0;
+
+    uint64_t rank = (uint64_t)(quantile * sampled);
+    uint64_t seen = 0;
+
+    for (uint8_t bucket = 0; bucket < DUNGEONSCALE_PERF_BUCKET_COUNT; ++bucket)
+    {
+        seen += buckets[bucket];
+        if (seen > rank)
+            return 1ull << (DUNGEONSCALE_PERF_FIRST_BUCKET_SHIFT + bucket);
+    }
+
+    return 1ull << (DUNGEONSCALE_PERF_FIRST_BUCKET_SHIFT + DUNGEONSCALE_PERF_BUCKET_COUNT - 1);
+}
+
+char const* GetPerfHookName(DungeonScalePerfHook hook)
+{
+    switch (hook)
+    {
+        case DUNGEONSCALE_PERF_ON_ALL_CREATURE_UPDATE:              return "OnAllCreatureUpdate";
+        case DUNGEONSCALE_PERF_MODIFY_MELEE_DAMAGE:                 return "ModifyMeleeDamage";
+        case DUNGEONSCALE_PERF_MODIFY_SPELL_DAMAGE_TAKEN:           return "ModifySpellDamageTaken";
+        case DUNGEONSCALE_PERF_MODIFY_PERIODIC_DAMAGE_AURAS_TICK:   return "ModifyPeriodicDamageAurasTick";
+        case DUNGEONSCALE_PERF_MODIFY_HEAL_RECEIVED:                return "ModifyHealReceived";
+        case DUNGEONSCALE_PERF_ON_AURA_APPLY:                       return "OnAuraApply";
+        case DUNGEONSCALE_PERF_ON_ITEM_ROLL:                        return "OnItemRoll";
+        case DUNGEONSCALE_PERF_ON_PLAYER_ENTER_ALL:                 return "OnPlayerEnterAll";
+        case DUNGEONSCALE_PERF_ON_PLAYER_LEAVE_ALL:                 return "OnPlayerLeaveAll";
+        case DUNGEONSCALE_PERF_MODIFY_CREATURE_ATTRIBUTES:          return "ModifyCreatureAttributes";
+        case DUNGEONSCALE_PERF_UPDATE_MAP_DATA_IF_NEEDED:           return "UpdateMapDataIfNeeded";
+        default:                                                    return "Unknown";
+    }
+}
@@ -0,0 +1,186 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Runtime instrumentation for DungeonScale
+*
+* Per-thread call counters and fixed-bucket latency histograms for the module's script entry points. Each thread
+* that runs a hook (the map update threads, the world thread) gets its own counters, so recording never contends;
+* `.dungeonscale perf` sums them on demand. Every call is counted, and one in `DungeonScale.Perf.SampleInterval`
+* calls per hook and thread is timed. Nested hooks (UpdateMapDataIfNeeded, ModifyCreatureAttributes inside
+* OnAllCreatureUpdate) are included in the outer hook's time.
+*
+* Server-wide gauges (enabled instances, tracked creatures, ...) use the same per-thread blocks: each map adds the
+* changes of its own values to the block of the thread it is updated on, and the sum across threads is the total.
+*
+* Like the scaling engine, this doesn't depend on AzerothCore.
+*/
+
+#ifndef MOD_DUNGEONSCALE_PERF_H
+#define MOD_DUNGEONSCALE_PERF_H
+
+#include "DungeonScaleEngine.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+enum DungeonScalePerfHook : uint8_t
+{
+    DUNGEONSCALE_PERF_ON_ALL_CREATURE_UPDATE = 0,
+    DUNGEONSCALE_PERF_MODIFY_MELEE_DAMAGE,
+    DUNGEONSCALE_PERF_MODIFY_SPELL_DAMAGE_TAKEN,
+    DUNGEONSCALE_PERF_MODIFY_PERIODIC_DAMAGE_AURAS_TICK,
+    DUNGEONSCALE_PERF_MODIFY_HEAL_RECEIVED,
+    DUNGEONSCALE_PERF_ON_AURA_APPLY,
+    DUNGEONSCALE_PERF_ON_ITEM_ROLL,
+    DUNGEONSCALE_PERF_ON_PLAYER_ENTER_ALL,
+    DUNGEONSCALE_PERF_ON_PLAYER_LEAVE_ALL,
+    DUNGEONSCALE_PERF_MODIFY_CREATURE_ATTRIBUTES,
+    DUNGEONSCALE_PERF_UPDATE_MAP_DATA_IF_NEEDED,
+    DUNGEONSCALE_PERF_HOOK_COUNT
+};
+
+enum DungeonScalePerfGauge : uint8_t
+{
+    DUNGEONSCALE_PERF_GAUGE_TRACKED_CREATURES = 0,  // creatures in the maps' creature lists
+    DUNGEONSCALE_PERF_GAUGE_ACTIVE_CREATURES,       // creatures included in the maps' stats
+    DUNGEONSCALE_PERF_GAUGE_COMBAT_LOCKED_MAPS,
+    DUNGEONSCALE_PERF_GAUGE_RESCALES,               // only ever grows
+    DUNGEONSCALE_PERF_GAUGE_ENABLED_INSTANCES,      // one per DungeonScaleInstanceType from here on
+    DUNGEONSCALE_PERF_GAUGE_COUNT = DUNGEONSCALE_PERF_GAUGE_ENABLED_INSTANCES + DUNGEONSCALE_INSTANCE_TYPE_COUNT
+};
+
+// bucket 0 is < 128ns, each following bucket doubles the upper bound, the last one is everything from ~2ms up
+constexpr uint8_t DUNGEONSCALE_PERF_BUCKET_COUNT = 15;
+constexpr uint8_t DUNGEONSCALE_PERF_FIRST_BUCKET_SHIFT = 7;
+
+// one thread's counters; only that thread writes them, so the atomics are plain loads and stores, not locked increments
+class DungeonScalePerfThreadCounters
+{
+public:
+    std::atomic<uint64_t> calls[DUNGEONSCALE_PERF_HOOK_COUNT] = {};
+    std::atomic<uint64_t> sampledCalls[DUNGEONSCALE_PERF_HOOK_COUNT] = {};
+    std::atomic<uint64_t> sampledNs[DUNGEONSCALE_PERF_HOOK_COUNT] = {};
+    std::atomic<uint64_t> buckets[DUNGEONSCALE_PERF_HOOK_COUNT][DUNGEONSCALE_PERF_BUCKET_COUNT] = {};
+    std::atomic<int64_t> gauges[DUNGEONSCALE_PERF_GAUGE_COUNT] = {};   // changes made on this thread, may be negative
+
+    uint32_t sampleCountdown[DUNGEONSCALE_PERF_HOOK_COUNT] = {};     // private to the thread
+};
+
+// one hook's totals across all threads
+class DungeonScalePerfHookStats
+{
+public:
+    uint64_t calls = 0;
+    uint64_t sampledCalls = 0;
+    uint64_t sampledNs = 0;
+    uint64_t buckets[DUNGEONSCALE_PERF_BUCKET_COUNT] = {};
+
+    double GetMeanNs() const { return sampledCalls ? (double)sampledNs / sampledCalls : 0.0; }
+    uint64_t GetQuantileNs(double quantile) const;  // upper bound of the bucket the quantile falls in
+};
+
+class DungeonScalePerfSnapshot
+{
+public:
+    DungeonScalePerfHookStats hooks[DUNGEONSCALE_PERF_HOOK_COUNT];
+    int64_t gauges[DUNGEONSCALE_PERF_GAUGE_COUNT] = {};    // never reset
+    uint32_t threadCount = 0;
+    uint64_t elapsedNs = 0;                         // since the counters were last reset
+};
+
+extern std::atomic<uint32_t> perfSampleInterval;   // DungeonScale.Perf.SampleInterval, 0 when DungeonScale.Perf.Enable is off
+extern thread_local DungeonScalePerfThreadCounters* perfThreadCounters;
+
+DungeonScalePerfThreadCounters* RegisterPerfThread();
+
+DungeonScalePerfSnapshot GetPerfSnapshot(bool sinceReset = true);
+void ResetPerfCounters();
+char const* GetPerfHookName(DungeonScalePerfHook hook);
+
+inline void IncrementPerfCounter(std::atomic<uint64_t>& counter, uint64_t amount = 1)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+inline void AddPerfGauge(DungeonScalePerfGauge gauge, int64_t delta)
+{
+    DungeonScalePerfThreadCounters* counters = perfThreadCounters ? perfThreadCounters : RegisterPerfThread();
+    counters->gauges[gauge].store(counters->gauges[gauge].load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+inline uint8_t GetPerfBucket(uint64_t ns)
+{
+    uint8_t bucket = 0;
+    for (ns >>= DUNGEONSCALE_PERF_FIRST_BUCKET_SHIFT; ns && bucket < DUNGEONSCALE_PERF_BUCKET_COUNT - 1; ns >>= 1)
+        ++bucket;
+
+    return bucket;
+}
+
+// counts the hook call and times it if it's this thread's turn
+class DungeonScalePerfScope
+{
+public:
+    explicit DungeonScalePerfScope(DungeonScalePerfHook hook) : _hook(hook)
+    {
+        uint32_t sampleInterval = perfSampleInterval.load(std::memory_order_relaxed);
+        if (!sampleInterval)
+            return;
+
+        _counters = perfThreadCounters ? perfThreadCounters : RegisterPerfThread();
+        IncrementPerfCounter(_counters->calls[hook]);
+
+        if (_counters->sampleCountdown[hook])
+        {
+            --_counters->sampleCountdown[hook];
+            return;
+        }
+
+        _counters->sampleCountdown[hook] = sampleInterval - 1;
+        _isSampled = true;
+        _start = std::chrono::steady_clock::now();
+    }
+
+    ~DungeonScalePerfScope()
+    {
+        if (!_isSampled)
+            return;
+
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+
+        IncrementPerfCounter(_counters->sampledCalls[_hook]);
+        IncrementPerfCounter(_counters->sampledNs[_hook], ns);
+        IncrementPerfCounter(_counters->buckets[_hook][GetPerfBucket(ns)]);
+    }
+
+    DungeonScalePerfScope(DungeonScalePerfScope const&) = delete;
+    DungeonScalePerfScope& operator=(DungeonScalePerfScope const&) = delete;
+
+private:
+    DungeonScalePerfThreadCounters* _counters = nullptr;
+    std::chrono::steady_clock::time_point _start;
+    DungeonScalePerfHook _hook;
+    bool _isSampled = false;
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Linux USDT probes for DungeonScale
+*
+* Static probe points on the module's decisions, for tracing a live worldserver with standard tooling (bpftrace,
+* perf, SystemTap, bcc) without a restart or a config change. Every probe has a semaphore that the tracer raises
+* while it's attached, so until then a probe is a load and a not-taken branch, and its arguments aren't evaluated.
+* They are only compiled in when <sys/sdt.h> is available (systemtap-sdt-dev / systemtap-sdt-devel), and can be
+* left out with -DDUNGEONSCALE_DISABLE_USDT. Otherwise they compile to nothing, their arguments aren't evaluated.
+*
+* Provider "dungeonscale", all arguments are integers, multipliers are in millionths (1000000 = 1.0). Each decision
+* has a __start probe on entry, which fires for every call, and a result probe once it is decided. Calls that leave
+* early (not an instance, not enabled, nothing to scale) only fire the __start probe:
+*
+*   creature__rescale__start    map id, instance id, creature entry
+*   creature__rescale           map id, instance id, creature entry, player count, health multiplier, damage multiplier
+*   damage__modify__start       map id, source entry (0 for players), spell id (0 for melee), amount
+*   damage__modify              map id, source entry (0 for players), spell id (0 for melee), branch, amount, multiplier, result
+*   aura__cc__duration__start   map id, caster entry, spell id, duration (ms)
+*   aura__cc__duration          map id, caster entry, spell id, original duration (ms), multiplier, new duration (ms)
+*   loot__roll__start           map id, item id
+*   loot__roll                  map id, item id, player count, max players, decision (0 = dropped, 1 = kept, 2 = exempt)
+*   map__reconfigure__start     map id, instance id, player count
+*   map__reconfigure            map id, instance id, player count, rescale trigger, world health multiplier, world damage multiplier
+*
+* For example, with the module built into the worldserver:
+*
+*   bpftrace -e 'usdt:./worldserver:dungeonscale:creature__rescale { @damage[arg2] = stats(arg5); }'
+*   bpftrace -e 'usdt:./worldserver:dungeonscale:map__reconfigure__start { @start[tid] = nsecs; }
+*                usdt:./worldserver:dungeonscale:map__reconfigure /@start[tid]/ { @ns = hist(nsecs - @start[tid]); delete(@start[tid]); }'
+*/
+
+#ifndef MOD_DUNGEONSCALE_PROBES_H
+#define MOD_DUNGEONSCALE_PROBES_H
+
+#include <cmath>
+#include <cstdint>
+
+#if !defined(DUNGEONSCALE_DISABLE_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#define DUNGEONSCALE_USDT 1
+#endif
+#endif
+
+#ifdef DUNGEONSCALE_USDT
+// raised by the tracer while it's attached to the probe, named the way <sys/sdt.h> expects (provider_name_semaphore)
+#define DUNGEONSCALE_PROBE_SEMAPHORE(name) \
+    __extension__ inline unsigned short dungeonscale_##name##_semaphore __attribute__((used)) __attribute__((section(".probes")))
+
+DUNGEONSCALE_PROBE_SEMAPHORE(creature__rescale__start);
+DUNGEONSCALE_PROBE_SEMAPHORE(creature__rescale);
+DUNGEONSCALE_PROBE_SEMAPHORE(damage__modify__start);
+DUNGEONSCALE_PROBE_SEMAPHORE(damage__modify);
+DUNGEONSCALE_PROBE_SEMAPHORE(aura__cc__duration__start);
+DUNGEONSCALE_PROBE_SEMAPHORE(aura__cc__duration);
+DUNGEONSCALE_PROBE_SEMAPHORE(loot__roll__start);
+DUNGEONSCALE_PROBE_SEMAPHORE(loot__roll);
+DUNGEONSCALE_PROBE_SEMAPHORE(map__reconfigure__start);
+DUNGEONSCALE_PROBE_SEMAPHORE(map__reconfigure);
+
+#define DUNGEONSCALE_PROBE_ENABLED(name) \
+    __builtin_expect(dungeonscale_##name##_semaphore, 0)
+
+#define DUNGEONSCALE_PROBE2(name, arg1, arg2) \
+    do { if (DUNGEONSCALE_PROBE_ENABLED(name)) DTRACE_PROBE2(dungeonscale, name, arg1, arg2); } while (0)
+#define DUNGEONSCALE_PROBE3(name, arg1, arg2, arg3) \
+    do { if (DUNGEONSCALE_PROBE_ENABLED(name)) DTRACE_PROBE3(dungeonscale, name, arg1, arg2, arg3); } while (0)
+#define DUNGEONSCALE_PROBE4(name, arg1, arg2, arg3, arg4) \
+    do { if (DUNGEONSCALE_PROBE_ENABLED(name)) DTRACE_PROBE4(dungeonscale, name, arg1, arg2, arg3, arg4); } while (0)
+#define DUNGEONSCALE_PROBE5(name, arg1, arg2, arg3, arg4, arg5) \
+    do { if (DUNGEONSCALE_PROBE_ENABLED(name)) DTRACE_PROBE5(dungeonscale, name, arg1, arg2, arg3, arg4, arg5); } while (0)
+#define DUNGEONSCALE_PROBE6(name, arg1, arg2, arg3, arg4, arg5, arg6) \
+    do { if (DUNGEONSCALE_PROBE_ENABLED(name)) DTRACE_PROBE6(dungeonscale, name, arg1, arg2, arg3, arg4, arg5, arg6); } while (0)
+#define DUNGEONSCALE_PROBE7(name, arg1, arg2, arg3, arg4, arg5, arg6, arg7) \
+    do { if (DUNGEONSCALE_PROBE_ENABLED(name)) DTRACE_PROBE7(dungeonscale, name, arg1, arg2, arg3, arg4, arg5, arg6, arg7); } while (0)
+#else
+// the arguments still count as used, so values only computed for a probe don't warn, but sizeof doesn't evaluate them
+#define DUNGEONSCALE_PROBE_UNUSED(arg) (void)sizeof(arg)
+#define DUNGEONSCALE_PROBE_ENABLED(name) false
+#define DUNGEONSCALE_PROBE2(name, arg1, arg2) \
+    do { DUNGEONSCALE_PROBE_UNUSED(arg1); DUNGEONSCALE_PROBE_UNUSED(arg2); } while (0)
+#define DUNGEONSCALE_PROBE3(name, arg1, arg2, arg3) \
+    do { DUNGEONSCALE_PROBE2(name, arg1, arg2); DUNGEONSCALE_PROBE_UNUSED(arg3); } while (0)
+#define DUNGEONSCALE_PROBE4(name, arg1, arg2, arg3, arg4) \
+    do { DUNGEONSCALE_PROBE3(name, arg1, arg2, arg3); DUNGEONSCALE_PROBE_UNUSED(arg4); } while (0)
+#define DUNGEONSCALE_PROBE5(name, arg1, arg2, arg3, arg4, arg5) \
+    do { DUNGEONSCALE_PROBE4(name, arg1, arg2, arg3, arg4); DUNGEONSCALE_PROBE_UNUSED(arg5); } while (0)
+#define DUNGEONSCALE_PROBE6(name, arg1, arg2, arg3, arg4, arg5, arg6) \
+    do { DUNGEONSCALE_PROBE5(name, arg1, arg2, arg3, arg4, arg5); DUNGEONSCALE_PROBE_UNUSED(arg6); } while (0)
+#define DUNGEONSCALE_PROBE7(name, arg1, arg2, arg3, arg4, arg5, arg6, arg7) \
+    do { DUNGEONSCALE_PROBE6(name, arg1, arg2, arg3, arg4, arg5, arg6); DUNGEONSCALE_PROBE_UNUSED(arg7); } while (0)
+#endif
+
+// probe arguments are integers
+inline int64_t GetProbeMultiplier(float multiplier)
+{
+    return std::llround(multiplier * 1000000.0);
+}
+
+#endif
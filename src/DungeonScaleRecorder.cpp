@@ -0,0 +1,435 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DungeonScaleRecorder.h"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+// damage/healing event flags
+#define DUNGEONSCALE_RECORD_EVENT_SOURCE_IS_PLAYER          0x01
+#define DUNGEONSCALE_RECORD_EVENT_SOURCE_IS_CREATURE        0x02
+#define DUNGEONSCALE_RECORD_EVENT_TARGET_IS_PLAYER          0x04
+#define DUNGEONSCALE_RECORD_EVENT_IS_SELF                   0x08
+#define DUNGEONSCALE_RECORD_EVENT_MAPS_ENABLED              0x10
+#define DUNGEONSCALE_RECORD_EVENT_IS_PLAYER_CONTROLLED      0x20
+#define DUNGEONSCALE_RECORD_EVENT_TARGET_IS_FRIENDLY        0x40
+#define DUNGEONSCALE_RECORD_EVENT_IS_SHARE_DAMAGE_AURA      0x80
+
+//
+// File format: the header and the records go through the same field list for writing and reading
+//
+
+// appends each field in little-endian byte order
+class DungeonScaleRecordingWriter
+{
+public:
+    std::vector<uint8_t> bytes;
+
+    template <class T>
+    void operator()(T const& value)
+    {
+        uint64_t bits;
+        if constexpr (std::is_same_v<T, float>)
+            bits = std::bit_cast<uint32_t>(value);
+        else
+            bits = (uint64_t)value;
+
+        for (size_t i = 0; i < sizeof(T); ++i)
+            bytes.push_back((uint8_t)(bits >> (8 * i)));
+    }
+};
+
+// reads each field back, `isTruncated` is set once a field runs past the end
+class DungeonScaleRecordingReader
+{
+public:
+    DungeonScaleRecordingReader(uint8_t const* data, size_t size) : data(data), remaining(size) {}
+
+    bool isTruncated = false;
+
+    template <class T>
+    void operator()(T& value)
+    {
+        if (remaining < sizeof(T))
+        {
+            isTruncated = true;
+            return;
+        }
+
+        uint64_t bits = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+            bits |= (uint64_t)data[i] << (8 * i);
+
+        if constexpr (std::is_same_v<T, float>)
+            value = std::bit_cast<float>((uint32_t)bits);
+        else
+            value = (T)bits;
+
+        data += sizeof(T);
+        remaining -= sizeof(T);
+    }
+
+private:
+    uint8_t const* data;
+    size_t remaining;
+};
+
+template <class Archive, class StatModifiers>
+static void SerializeStatModifiers(Archive& archive, StatModifiers& statModifiers)
+{
+    archive(statModifiers.global);
+    archive(statModifiers.health);
+    archive(statModifiers.mana);
+    archive(statModifiers.armor);
+    archive(statModifiers.damage);
+    archive(statModifiers.ccduration);
+}
+
+template <class Archive, class InflectionPointSettings>
+static void SerializeInflectionPointSettings(Archive& archive, InflectionPointSettings& settings)
+{
+    archive(settings.value);
+    archive(settings.curveFloor);
+    archive(settings.curveCeiling);
+}
+
+template <class Archive, class Header>
+static void SerializeHeader(Archive& archive, Header& header)
+{
+    for (auto& character : header.magic)
+        archive(character);
+
+    archive(header.version);
+    archive(header.recordSize);
+    archive(header.recordCount);
+    archive(header.droppedRecords);
+    archive(header.startTime);
+
+    // a file from another version has a different layout from here on
+    if (header.version != DUNGEONSCALE_RECORDING_VERSION)
+        return;
+
+    archive(header.droppedCreatureRecords);
+
+    archive(header.mapId);
+    archive(header.instanceId);
+    archive(header.maxPlayers);
+    archive(header.isHeroic);
+    archive(header.playerCountDifficultyOffset);
+    archive(header.overrides);
+    archive(header.reserved);
+
+    SerializeInflectionPointSettings(archive, header.inflectionPoint);
+    archive(header.inflectionPoint.bossModifier);
+    SerializeStatModifiers(archive, header.statModifiers);
+    SerializeStatModifiers(archive, header.bossStatModifiers);
+    SerializeInflectionPointSettings(archive, header.dungeonOverride);
+    SerializeInflectionPointSettings(archive, header.bossOverride);
+    SerializeStatModifiers(archive, header.statModifierOverride);
+    SerializeStatModifiers(archive, header.statModifierBossOverride);
+
+    archive(header.minHPModifier);
+    archive(header.minManaModifier);
+    archive(header.minDamageModifier);
+    archive(header.minCCDurationModifier);
+    archive(header.maxCCDurationModifier);
+}
+
+template <class Archive, class Record>
+static void SerializeRecord(Archive& archive, Record& record)
+{
+    archive(record.time);
+    archive(record.id);
+    archive(record.type);
+    archive(record.flags);
+    archive(record.playerCount);
+    archive(record.detail);
+
+    for (auto& value : record.values)
+        archive(value);
+}
+
+// the ring and the creature table together have to fit the header's 32-bit record count
+DungeonScaleRecorder::DungeonScaleRecorder(uint32_t capacity, uint64_t now, uint64_t startTime) :
+    records(std::clamp<uint32_t>(capacity, 1, UINT32_MAX / 5 * 4)),
+    creatureRecords(std::max<size_t>(1, records.size() / 4)),
+    startSteadyTime(now), startTime(startTime)
+{
+}
+
+void DungeonScaleRecorder::Stamp(DungeonScaleRecord& record, DungeonScaleRecordType type, uint32_t id, uint64_t now) const
+{
+    record = DungeonScaleRecord();
+    record.time = (uint32_t)(now - startSteadyTime);
+    record.id = id;
+    record.type = type;
+}
+
+DungeonScaleRecord& DungeonScaleRecorder::Append(DungeonScaleRecordType type, uint32_t id, uint64_t now)
+{
+    DungeonScaleRecord& record = records[next];
+    Stamp(record, type, id, now);
+
+    if (++next == records.size())
+        next = 0;
+
+    if (count < records.size())
+        count++;
+
+    totalRecorded++;
+
+    return record;
+}
+
+DungeonScaleRecord* DungeonScaleRecorder::AppendCreature(DungeonScaleRecordType type, uint32_t id, uint64_t now, uint32_t followingRecords)
+{
+    // the creature's records go in together or not at all, a replay can't use an added creature without its override
+    if (creatureRecords.size() - creatureCount < size_t(followingRecords) + 1)
+    {
+        droppedCreatureRecords += followingRecords + 1;
+        return nullptr;
+    }
+
+    DungeonScaleRecord& record = creatureRecords[creatureCount++];
+    Stamp(record, type, id, now);
+
+    return &record;
+}
+
+bool DungeonScaleRecorder::Save(std::string const& path, DungeonScaleRecordingHeader header) const
+{
+    header.recordCount = GetRecordCount();
+    header.droppedRecords = GetDroppedRecords();
+    header.droppedCreatureRecords = GetDroppedCreatureRecords();
+    header.startTime = startTime;
+
+    // merge the creature table into the ring buffer's records by time, the oldest ring record is at `next` once the buffer has wrapped
+    std::vector<DungeonScaleRecord> orderedRecords;
+    orderedRecords.reserve(header.recordCount);
+
+    uint32_t first = count < records.size() ? 0 : next;
+    size_t creatureIndex = 0;
+
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        DungeonScaleRecord const& record = records[(first + index) % records.size()];
+
+        // a creature is added before anything else happens to it in the same millisecond
+        while (creatureIndex < creatureCount && creatureRecords[creatureIndex].time <= record.time)
+            orderedRecords.push_back(creatureRecords[creatureIndex++]);
+
+        orderedRecords.push_back(record);
+    }
+
+    orderedRecords.insert(orderedRecords.end(), creatureRecords.begin() + creatureIndex, creatureRecords.begin() + creatureCount);
+
+    DungeonScaleRecordingWriter writer;
+    writer.bytes.reserve(256 + orderedRecords.size() * DUNGEONSCALE_RECORDING_RECORD_SIZE);
+
+    SerializeHeader(writer, header);
+    for (DungeonScaleRecord const& record : orderedRecords)
+        SerializeRecord(writer, record);
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    bool written = fwrite(writer.bytes.data(), 1, writer.bytes.size(), file) == writer.bytes.size();
+
+    return fclose(file) == 0 && written;
+}
+
+char const* GetRecordTypeName(DungeonScaleRecordType type)
+{
+    switch (type)
+    {
+        case DUNGEONSCALE_RECORD_MAP_RESCALE:           return "MapRescale";
+        case DUNGEONSCALE_RECORD_CREATURE_ADDED:        return "CreatureAdded";
+        case DUNGEONSCALE_RECORD_CREATURE_OVERRIDE:     return "CreatureOverride";
+        case DUNGEONSCALE_RECORD_CREATURE_RESCALE:      return "CreatureRescale";
+        case DUNGEONSCALE_RECORD_DAMAGE_HEALING:        return "DamageHealing";
+        default:                                        return "Unknown";
+    }
+}
+
+void SetRecordingConfig(DungeonScaleRecordingHeader& header, DungeonScaleEngineConfig const& config, DungeonScaleMapDescriptor const& map)
+{
+    DungeonScaleInstanceType instanceType = GetInstanceType(map.maxPlayers, map.isHeroic);
+
+    header.mapId = map.mapId;
+    header.maxPlayers = map.maxPlayers;
+    header.isHeroic = map.isHeroic;
+    header.playerCountDifficultyOffset = config.playerCountDifficultyOffset;
+
+    header.inflectionPoint = config.inflectionPoints[instanceType];
+    header.statModifiers = config.statModifiers[instanceType];
+    header.bossStatModifiers = config.bossStatModifiers[instanceType];
+
+    header.minHPModifier = config.multiplierLimits.minHealth;
+    header.minManaModifier = config.multiplierLimits.minMana;
+    header.minDamageModifier = config.multiplierLimits.minDamage;
+    header.minCCDurationModifier = config.multiplierLimits.minCCDuration;
+    header.maxCCDurationModifier = config.multiplierLimits.maxCCDuration;
+
+    header.overrides = 0;
+
+    auto dungeonOverrideIterator = config.dungeonOverrides.find(map.mapId);
+    if (dungeonOverrideIterator != config.dungeonOverrides.end())
+    {
+        header.dungeonOverride = dungeonOverrideIterator->second;
+        header.overrides |= DUNGEONSCALE_RECORDING_DUNGEON_OVERRIDE;
+    }
+
+    auto bossOverrideIterator = config.bossOverrides.find(map.mapId);
+    if (bossOverrideIterator != config.bossOverrides.end())
+    {
+        header.bossOverride = bossOverrideIterator->second;
+        header.overrides |= DUNGEONSCALE_RECORDING_BOSS_OVERRIDE;
+    }
+
+    auto statModifierOverrideIterator = config.statModifierOverrides.find(map.mapId);
+    if (statModifierOverrideIterator != config.statModifierOverrides.end())
+    {
+        header.statModifierOverride = statModifierOverrideIterator->second;
+        header.overrides |= DUNGEONSCALE_RECORDING_STAT_MODIFIER_OVERRIDE;
+    }
+
+    auto statModifierBossOverrideIterator = config.statModifierBossOverrides.find(map.mapId);
+    if (statModifierBossOverrideIterator != config.statModifierBossOverrides.end())
+    {
+        header.statModifierBossOverride = statModifierBossOverrideIterator->second;
+        header.overrides |= DUNGEONSCALE_RECORDING_STAT_MODIFIER_BOSS_OVERRIDE;
+    }
+}
+
+DungeonScaleEngineConfig GetRecordingEngineConfig(DungeonScaleRecordingHeader const& header)
+{
+    DungeonScaleInstanceType instanceType = GetInstanceType(header.maxPlayers, header.isHeroic);
+
+    DungeonScaleEngineConfig config;
+    config.playerCountDifficultyOffset = header.playerCountDifficultyOffset;
+    config.inflectionPoints[instanceType] = header.inflectionPoint;
+    config.statModifiers[instanceType] = header.statModifiers;
+    config.bossStatModifiers[instanceType] = header.bossStatModifiers;
+
+    config.multiplierLimits.minHealth = header.minHPModifier;
+    config.multiplierLimits.minMana = header.minManaModifier;
+    config.multiplierLimits.minDamage = header.minDamageModifier;
+    config.multiplierLimits.minCCDuration = header.minCCDurationModifier;
+    config.multiplierLimits.maxCCDuration = header.maxCCDurationModifier;
+
+    if (header.overrides & DUNGEONSCALE_RECORDING_DUNGEON_OVERRIDE)
+        config.dungeonOverrides[header.mapId] = header.dungeonOverride;
+
+    if (header.overrides & DUNGEONSCALE_RECORDING_BOSS_OVERRIDE)
+        config.bossOverrides[header.mapId] = header.bossOverride;
+
+    if (header.overrides & DUNGEONSCALE_RECORDING_STAT_MODIFIER_OVERRIDE)
+        config.statModifierOverrides[header.mapId] = header.statModifierOverride;
+
+    if (header.overrides & DUNGEONSCALE_RECORDING_STAT_MODIFIER_BOSS_OVERRIDE)
+        config.statModifierBossOverrides[header.mapId] = header.statModifierBossOverride;
+
+    return config;
+}
+
+DungeonScaleMapDescriptor GetRecordingMapDescriptor(DungeonScaleRecordingHeader const& header, uint8_t adjustedPlayerCount)
+{
+    DungeonScaleMapDescriptor mapDescriptor;
+    mapDescriptor.mapId = header.mapId;
+    mapDescriptor.maxPlayers = header.maxPlayers;
+    mapDescriptor.isHeroic = header.isHeroic;
+    mapDescriptor.adjustedPlayerCount = adjustedPlayerCount;
+
+    return mapDescriptor;
+}
+
+uint8_t PackDamageHealingEventFlags(DungeonScaleDamageHealingEvent const& event)
+{
+    return (event.sourceIsPlayer ? DUNGEONSCALE_RECORD_EVENT_SOURCE_IS_PLAYER : 0) |
+           (event.sourceIsCreature ? DUNGEONSCALE_RECORD_EVENT_SOURCE_IS_CREATURE : 0) |
+           (event.targetIsPlayer ? DUNGEONSCALE_RECORD_EVENT_TARGET_IS_PLAYER : 0) |
+           (event.isSelf ? DUNGEONSCALE_RECORD_EVENT_IS_SELF : 0) |
+           (event.mapsEnabled ? DUNGEONSCALE_RECORD_EVENT_MAPS_ENABLED : 0) |
+           (event.isPlayerControlled ? DUNGEONSCALE_RECORD_EVENT_IS_PLAYER_CONTROLLED : 0) |
+           (event.targetIsFriendly ? DUNGEONSCALE_RECORD_EVENT_TARGET_IS_FRIENDLY : 0) |
+           (event.isShareDamageAura ? DUNGEONSCALE_RECORD_EVENT_IS_SHARE_DAMAGE_AURA : 0);
+}
+
+void UnpackDamageHealingEventFlags(uint8_t flags, DungeonScaleDamageHealingEvent& event)
+{
+    event.sourceIsPlayer = flags & DUNGEONSCALE_RECORD_EVENT_SOURCE_IS_PLAYER;
+    event.sourceIsCreature = flags & DUNGEONSCALE_RECORD_EVENT_SOURCE_IS_CREATURE;
+    event.targetIsPlayer = flags & DUNGEONSCALE_RECORD_EVENT_TARGET_IS_PLAYER;
+    event.isSelf = flags & DUNGEONSCALE_RECORD_EVENT_IS_SELF;
+    event.mapsEnabled = flags & DUNGEONSCALE_RECORD_EVENT_MAPS_ENABLED;
+    event.isPlayerControlled = flags & DUNGEONSCALE_RECORD_EVENT_IS_PLAYER_CONTROLLED;
+    event.targetIsFriendly = flags & DUNGEONSCALE_RECORD_EVENT_TARGET_IS_FRIENDLY;
+    event.isShareDamageAura = flags & DUNGEONSCALE_RECORD_EVENT_IS_SHARE_DAMAGE_AURA;
+}
+
+bool LoadRecording(std::string const& path, DungeonScaleRecordingHeader& header, std::vector<DungeonScaleRecord>& records, std::string& error)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[65536];
+    size_t bytesRead;
+
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        bytes.insert(bytes.end(), buffer, buffer + bytesRead);
+
+    fclose(file);
+
+    DungeonScaleRecordingHeader expected;
+    DungeonScaleRecordingReader reader(bytes.data(), bytes.size());
+    SerializeHeader(reader, header);
+
+    if (reader.isTruncated)
+        error = "file is too short for a recording header";
+    else if (memcmp(header.magic, expected.magic, sizeof(header.magic)))
+        error = "not a DungeonScale recording";
+    else if (header.version != expected.version || header.recordSize != expected.recordSize)
+        error = "recording version " + std::to_string(header.version) + " with " + std::to_string(header.recordSize) + "-byte records is not supported";
+    else
+    {
+        records.resize(header.recordCount);
+
+        for (DungeonScaleRecord& record : records)
+            SerializeRecord(reader, record);
+
+        if (reader.isTruncated)
+            error = "file is truncated";
+        else
+            return true;
+    }
+
+    return false;
+}
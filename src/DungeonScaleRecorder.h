@@ -0,0 +1,177 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Binary event recorder for DungeonScale
+*
+* With `DungeonScale.Recorder.Enable`, every new instance keeps a ring buffer of fixed-size records of what went
+* into and came out of its scaling decisions: rescale waves, creature rescales and damage/healing multipliers.
+* Appending a record is a copy into a preallocated slot, so recording costs far less than the debug logs. Creatures
+* joining the map are kept in a second preallocated table, a quarter of the ring's size, that doesn't wrap, so the
+* overrides the replay needs are never overwritten. Once it is full, later creatures are counted as dropped instead.
+* Both are written to a file when the instance unloads or on `.dungeonscale record`, and
+* tools/DungeonScaleReplay.cpp runs the recording back through the scaling engine.
+*
+* A recording file is a DungeonScaleRecordingHeader followed by its records, oldest first, written field by field
+* in little-endian byte order so it can be replayed on any machine. Like the scaling engine, this doesn't depend on
+* AzerothCore.
+*/
+
+#ifndef MOD_DUNGEONSCALE_RECORDER_H
+#define MOD_DUNGEONSCALE_RECORDER_H
+
+#include "DungeonScaleEngine.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define DUNGEONSCALE_RECORDING_VERSION 3
+#define DUNGEONSCALE_RECORDING_RECORD_SIZE 36       // bytes per record in the file
+
+enum DungeonScaleRecordType : uint8_t
+{
+    DUNGEONSCALE_RECORD_MAP_RESCALE = 0,            // a rescale wave started
+    DUNGEONSCALE_RECORD_CREATURE_ADDED,             // a creature joined the map's creature list
+    DUNGEONSCALE_RECORD_CREATURE_OVERRIDE,          // follows CREATURE_ADDED for creatures with DungeonScale.StatModifier.PerCreature settings
+    DUNGEONSCALE_RECORD_CREATURE_RESCALE,           // a creature's scaled stats were applied
+    DUNGEONSCALE_RECORD_DAMAGE_HEALING,             // a damage or healing amount went through the multiplier decision
+    DUNGEONSCALE_RECORD_TYPE_COUNT
+};
+
+// MAP_RESCALE flags
+#define DUNGEONSCALE_RECORD_FLAG_CONFIG_RELOADED    0x01    // the wave was caused by a config reload
+#define DUNGEONSCALE_RECORD_FLAG_WORLD_SCALED       0x02    // the world multipliers were calculated rather than left at 1
+
+// CREATURE_RESCALE flags
+#define DUNGEONSCALE_RECORD_FLAG_BOSS               0x01
+#define DUNGEONSCALE_RECORD_FLAG_HAS_MANA           0x02
+
+// which of the per-instance overrides in the header are set
+#define DUNGEONSCALE_RECORDING_DUNGEON_OVERRIDE             0x01
+#define DUNGEONSCALE_RECORDING_BOSS_OVERRIDE                0x02
+#define DUNGEONSCALE_RECORDING_STAT_MODIFIER_OVERRIDE       0x04
+#define DUNGEONSCALE_RECORDING_STAT_MODIFIER_BOSS_OVERRIDE  0x08
+
+//
+// what the values of each record type hold
+//
+// MAP_RESCALE        playerCount, detail = rescale trigger, values = world health multiplier, world damage/healing multiplier, map level
+// CREATURE_ADDED     id = entry, values = level
+// CREATURE_OVERRIDE  id = entry, values = global, health, mana, armor, damage, ccduration
+// CREATURE_RESCALE   id = entry, playerCount, values = default multiplier, health, mana, armor, damage and cc duration multipliers
+// DAMAGE_HEALING     id = spell (0 for melee), flags = event, detail = branch, playerCount, values = amount, multiplier, result
+//
+class DungeonScaleRecord
+{
+public:
+    uint32_t time = 0;                              // milliseconds since the recording started
+    uint32_t id = 0;
+    uint8_t type = 0;
+    uint8_t flags = 0;
+    uint8_t playerCount = 0;                        // the map's adjusted player count at the time
+    uint8_t detail = 0;
+    float values[6] = {};
+};
+
+// the instance and the config that applied to it when the recording was written
+class DungeonScaleRecordingHeader
+{
+public:
+    char magic[4] = { 'D', 'S', 'R', 'C' };
+    uint32_t version = DUNGEONSCALE_RECORDING_VERSION;
+    uint32_t recordSize = DUNGEONSCALE_RECORDING_RECORD_SIZE;
+    uint32_t recordCount = 0;                       // records in the file
+    uint64_t droppedRecords = 0;                    // older records the ring buffer overwrote
+    uint64_t startTime = 0;                         // unix time of the start of the recording
+    uint64_t droppedCreatureRecords = 0;            // CREATURE_ADDED and CREATURE_OVERRIDE records that didn't fit in the creature table
+
+    uint32_t mapId = 0;
+    uint32_t instanceId = 0;
+    uint32_t maxPlayers = 0;
+    uint8_t isHeroic = 0;
+    int8_t playerCountDifficultyOffset = 0;
+    uint8_t overrides = 0;                          // DUNGEONSCALE_RECORDING_*_OVERRIDE
+    uint8_t reserved = 0;
+
+    DungeonScaleInflectionPointConfig inflectionPoint;
+    DungeonScaleStatModifiers statModifiers;
+    DungeonScaleStatModifiers bossStatModifiers;
+    DungeonScaleInflectionPointSettings dungeonOverride;
+    DungeonScaleInflectionPointSettings bossOverride;
+    DungeonScaleStatModifiers statModifierOverride;
+    DungeonScaleStatModifiers statModifierBossOverride;
+
+    float minHPModifier = 0.1f;
+    float minManaModifier = 0.01f;
+    float minDamageModifier = 0.01f;
+    float minCCDurationModifier = 0.25f;
+    float maxCCDurationModifier = 1.0f;
+};
+
+class DungeonScaleRecorder
+{
+public:
+    DungeonScaleRecorder(uint32_t capacity, uint64_t now, uint64_t startTime);
+
+    // the returned slot is cleared and stamped, the caller fills in the rest
+    DungeonScaleRecord& Append(DungeonScaleRecordType type, uint32_t id, uint64_t now);
+
+    // CREATURE_ADDED and CREATURE_OVERRIDE records, kept for the whole recording
+    // returns nullptr and counts them as dropped if the table has no room left for this record and the `followingRecords` after it
+    DungeonScaleRecord* AppendCreature(DungeonScaleRecordType type, uint32_t id, uint64_t now, uint32_t followingRecords = 0);
+
+    uint32_t GetRecordCount() const { return count + creatureCount; }
+    uint64_t GetDroppedRecords() const { return totalRecorded - count; }
+    uint64_t GetDroppedCreatureRecords() const { return droppedCreatureRecords; }
+
+    // header describes the instance and its config, the record counts are filled in
+    // both kinds of records are written in the order they were recorded
+    bool Save(std::string const& path, DungeonScaleRecordingHeader header) const;
+
+private:
+    void Stamp(DungeonScaleRecord& record, DungeonScaleRecordType type, uint32_t id, uint64_t now) const;
+
+    std::vector<DungeonScaleRecord> records;
+    std::vector<DungeonScaleRecord> creatureRecords;
+    uint32_t next = 0;
+    uint32_t count = 0;
+    uint32_t creatureCount = 0;
+    uint64_t totalRecorded = 0;
+    uint64_t droppedCreatureRecords = 0;
+    uint64_t startSteadyTime;                       // the `now` that record times are relative to
+    uint64_t startTime;                             // unix time, for the header
+};
+
+char const* GetRecordTypeName(DungeonScaleRecordType type);
+
+// the map's part of the config goes into the header, and back out into an engine config for a replay
+void SetRecordingConfig(DungeonScaleRecordingHeader& header, DungeonScaleEngineConfig const& config, DungeonScaleMapDescriptor const& map);
+DungeonScaleEngineConfig GetRecordingEngineConfig(DungeonScaleRecordingHeader const& header);
+DungeonScaleMapDescriptor GetRecordingMapDescriptor(DungeonScaleRecordingHeader const& header, uint8_t adjustedPlayerCount);
+
+// the damage/healing event's booleans are stored in the record's flags
+uint8_t PackDamageHealingEventFlags(DungeonScaleDamageHealingEvent const& event);
+void UnpackDamageHealingEventFlags(uint8_t flags, DungeonScaleDamageHealingEvent& event);
+
+bool LoadRecording(std::string const& path, DungeonScaleRecordingHeader& header, std::vector<DungeonScaleRecord>& records, std::string& error);
+
+#endif
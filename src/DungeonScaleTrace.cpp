@@ -0,0 +1,100 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DungeonScaleTrace.h"
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+std::atomic<bool> traceEnabled{false};
+
+static std::mutex traceLock;
+static FILE* traceFile = nullptr;
+static uint64_t traceEventCount = 0;
+
+// small sequential ids read better in a trace viewer than the platform's thread ids
+static std::atomic<uint32_t> nextTraceThreadId{1};
+static thread_local uint32_t traceThreadId = 0;
+
+static uint32_t GetTraceThreadId()
+{
+    if (!traceThreadId)
+        traceThreadId = nextTraceThreadId.fetch_add(1, std::memory_order_relaxed);
+
+    return traceThreadId;
+}
+
+uint64_t GetTraceTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void StartTrace(std::string const& path)
+{
+    StopTrace();
+
+    std::lock_guard<std::mutex> guard(traceLock);
+
+    traceFile = fopen(path.c_str(), "w");
+    if (!traceFile)
+        return;
+
+    fprintf(traceFile, "[\n");
+    traceEventCount = 0;
+    traceEnabled = true;
+}
+
+void StopTrace()
+{
+    std::lock_guard<std::mutex> guard(traceLock);
+
+    traceEnabled = false;
+
+    if (!traceFile)
+        return;
+
+    fprintf(traceFile, "\n]\n");
+    fclose(traceFile);
+    traceFile = nullptr;
+}
+
+void WriteTraceSpan(char const* name, uint64_t startUs, uint64_t durationUs, uint32_t mapId, uint32_t instanceId, std::string const& args)
+{
+    uint32_t threadId = GetTraceThreadId();
+
+    std::lock_guard<std::mutex> guard(traceLock);
+
+    if (!traceFile)
+        return;
+
+    fprintf(traceFile, "%s{\"name\":\"%s\",\"cat\":\"dungeonscale\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,\"pid\":1,\"tid\":%u,\"args\":{\"map\":%u,\"instance\":%u%s%s}}",
+        traceEventCount++ ? ",\n" : "",
+        name,
+        (unsigned long long)startUs,
+        (unsigned long long)durationUs,
+        threadId,
+        mapId,
+        instanceId,
+        args.empty() ? "" : ",",
+        args.c_str()
+    );
+}
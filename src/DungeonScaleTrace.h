@@ -0,0 +1,79 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Chrome trace export for DungeonScale
+*
+* With `DungeonScale.Trace.Enable`, the module's heavy operations (map reconfiguration in UpdateMapDataIfNeeded,
+* rescale waves, config reloads, OnCreateMap and OnPlayerEnterAll's creature re-walk) are written as spans to a
+* local file in the Chrome trace-event JSON format, for chrome://tracing, Perfetto or any other trace viewer.
+* Each span carries the map id and instance id, and is placed on the thread that ran it.
+*
+* These are the rare, expensive operations and not the per-creature or per-hit hooks, so the spans go straight to
+* the file under a lock. Like the scaling engine, this doesn't depend on AzerothCore.
+*/
+
+#ifndef MOD_DUNGEONSCALE_TRACE_H
+#define MOD_DUNGEONSCALE_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+extern std::atomic<bool> traceEnabled;
+
+// (re)starts the trace in a new file, stopping the previous one first
+void StartTrace(std::string const& path);
+void StopTrace();
+
+// steady clock, in microseconds
+uint64_t GetTraceTimeUs();
+
+// args are extra JSON members for the span's args, e.g. "\"creatures\":12"
+void WriteTraceSpan(char const* name, uint64_t startUs, uint64_t durationUs, uint32_t mapId, uint32_t instanceId, std::string const& args = "");
+
+// a span from construction to destruction, only if tracing was already on at the start
+class DungeonScaleTraceScope
+{
+public:
+    DungeonScaleTraceScope(char const* name, uint32_t mapId, uint32_t instanceId) :
+        name(name), mapId(mapId), instanceId(instanceId), startUs(traceEnabled.load(std::memory_order_relaxed) ? GetTraceTimeUs() : 0)
+    {
+    }
+
+    ~DungeonScaleTraceScope()
+    {
+        if (startUs && traceEnabled.load(std::memory_order_relaxed))
+            WriteTraceSpan(name, startUs, GetTraceTimeUs() - startUs, mapId, instanceId);
+    }
+
+    DungeonScaleTraceScope(DungeonScaleTraceScope const&) = delete;
+    DungeonScaleTraceScope& operator=(DungeonScaleTraceScope const&) = delete;
+
+private:
+    char const* name;
+    uint32_t mapId;
+    uint32_t instanceId;
+    uint64_t startUs;
+};
+
+#endif
@@ -0,0 +1,424 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Microbenchmarks for the DungeonScale scaling engine
+*
+* Measures the scaling math and the hook decision paths in isolation and reports ns/op and heap allocations/op:
+*   - the default multiplier curve across all player counts
+*   - stat modifier resolution for every instance category, with and without per-instance and per-creature overrides
+*   - the damage/healing decision for each source/target combination
+*   - the loot roll exemption checks
+*   - the config override parsers on realistic strings
+*
+* Build and run from the module root (no worldserver needed):
+*
+*   g++ -std=c++20 -O2 -I src tools/DungeonScaleBench.cpp src/DungeonScaleEngine.cpp -o dungeonscale_bench
+*   ./dungeonscale_bench [name filter] [--min-time-ms N]
+*/
+
+#include "DungeonScaleEngine.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+// count every heap allocation made by the process
+static std::atomic<uint64_t> allocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+// keep the compiler from optimizing the measured work away
+template <typename T>
+inline void DoNotOptimize(T const& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class BenchCase
+{
+public:
+    std::string name;
+    std::function<void(uint64_t)> run;             // runs the operation the given number of times
+    uint64_t opsPerRun = 1;                         // operations done per iteration of run
+};
+
+static void RunCase(BenchCase const& benchCase, double minTimeMs)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // warm up and find an iteration count that takes long enough to measure
+    uint64_t iterations = 1;
+    double elapsedNs = 0;
+    uint64_t allocations = 0;
+
+    while (true)
+    {
+        uint64_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        auto start = Clock::now();
+        benchCase.run(iterations);
+        elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+        if (elapsedNs >= minTimeMs * 1e6 || iterations >= (1ull << 40))
+            break;
+
+        iterations *= elapsedNs < minTimeMs * 1e5 ? 10 : 2;
+    }
+
+    double ops = (double)iterations * benchCase.opsPerRun;
+    printf("%-58s %12.2f ns/op %10.2f allocs/op %14llu ops\n",
+        benchCase.name.c_str(),
+        elapsedNs / ops,
+        allocations / ops,
+        (unsigned long long)ops
+    );
+}
+
+static DungeonScaleEngineConfig MakeConfig()
+{
+    DungeonScaleEngineConfig config;
+
+    // distinct values per category so a wrong lookup would show in the results
+    for (uint8_t instanceType = 0; instanceType < DUNGEONSCALE_INSTANCE_TYPE_COUNT; ++instanceType)
+    {
+        config.inflectionPoints[instanceType].value = 0.4f + instanceType * 0.01f;
+        config.inflectionPoints[instanceType].bossModifier = 1.1f;
+        config.bossStatModifiers[instanceType].health = 1.2f;
+    }
+
+    config.rewardScalingExceptionItemIDs = ParseIntsFromString("8444, 11078, 11197, 11602, 11885, 13302, 13303, 13304, 13305, 13306, 13307, 21761, 21762, 30436, 30437, 31088, 37372, 43151, 43158, 49351, 49352, 49635");
+
+    return config;
+}
+
+static DungeonScaleMapDescriptor MakeMap(uint32_t mapId, uint32_t maxPlayers, bool isHeroic, uint8_t adjustedPlayerCount)
+{
+    DungeonScaleMapDescriptor map;
+    map.mapId = mapId;
+    map.maxPlayers = maxPlayers;
+    map.isHeroic = isHeroic;
+    map.adjustedPlayerCount = adjustedPlayerCount;
+    return map;
+}
+
+static DungeonScaleDamageHealingEvent MakeEvent(int32_t amount, uint32_t spellId, bool sourceIsPlayer, bool sourceIsCreature, bool targetIsPlayer, bool isSelf)
+{
+    DungeonScaleDamageHealingEvent event;
+    event.amount = amount;
+    event.spellId = spellId;
+    event.sourceIsPlayer = sourceIsPlayer;
+    event.sourceIsCreature = sourceIsCreature;
+    event.targetIsPlayer = targetIsPlayer;
+    event.isSelf = isSelf;
+    return event;
+}
+
+static std::vector<BenchCase> MakeCases()
+{
+    std::vector<BenchCase> cases;
+
+    static DungeonScaleEngineConfig const config = MakeConfig();
+
+    static DungeonScaleEngineConfig const overrideConfig = []()
+    {
+        DungeonScaleEngineConfig overrides = MakeConfig();
+        overrides.dungeonOverrides = LoadInflectionPointOverrides("229 0.4 0.0 1.5, 309 -1 0.0 1.1, 48 0.3, 533 0.6, 603 0.55");
+        overrides.bossOverrides = LoadInflectionPointOverrides("229 1.2, 309 1.5, 48 1.25, 533 1.3, 603 1.4");
+        overrides.statModifierOverrides = LoadStatModifierOverrides("409 1.0 0.8 0.8 1.0 1.2 1.0, 568 -1 -1 -1 -1 1.35, 43 -1 1.2 1.2, 533 1.1, 603 -1 1.3");
+        overrides.statModifierBossOverrides = LoadStatModifierOverrides("409 1.0 0.8 0.8 1.0 1.2 0.8, 568 -1 -1 -1 -1 1.35, 43 -1 1.2 1.2, 533 -1 1.5");
+        overrides.statModifierCreatureOverrides = LoadStatModifierOverrides("14507 1.0 0.8 0.8 1.0 1.2 0.5, 11372 -1 -1 -1 -1 1.35, 15928 -1 1.2 1.2");
+        return overrides;
+    }();
+
+    //
+    // Default multiplier
+    //
+    for (uint32_t maxPlayers : { 5u, 10u, 25u, 40u })
+    {
+        cases.push_back({ "CalculateDefaultMultiplier/" + std::to_string(maxPlayers) + "M all player counts", [maxPlayers](uint64_t iterations)
+        {
+            DungeonScaleInflectionPointSettings settings(maxPlayers * 0.5f, 0.0f, 1.0f);
+            for (uint64_t i = 0; i < iterations; ++i)
+            {
+                for (uint32_t playerCount = 1; playerCount <= maxPlayers; ++playerCount)
+                {
+                    DungeonScaleMapDescriptor map = MakeMap(0, maxPlayers, false, playerCount);
+                    DoNotOptimize(map);
+                    DoNotOptimize(CalculateDefaultMultiplier(map, settings));
+                }
+            }
+        }, maxPlayers });
+    }
+
+    cases.push_back({ "CalculateInflectionPointSettings/all categories", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            for (uint32_t maxPlayers : { 5u, 10u, 15u, 20u, 25u, 40u, 80u })
+            {
+                DungeonScaleMapDescriptor map = MakeMap(1, maxPlayers, false, 1);
+                DoNotOptimize(map);
+                DoNotOptimize(CalculateInflectionPointSettings(config, map, false));
+                DoNotOptimize(CalculateInflectionPointSettings(config, map, true));
+            }
+        }
+    }, 14 });
+
+    cases.push_back({ "CalculateInflectionPointSettings/per-instance overrides", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            for (uint32_t mapId : { 229u, 309u, 48u, 533u, 603u, 1u })
+            {
+                DungeonScaleMapDescriptor map = MakeMap(mapId, 25, false, 1);
+                DoNotOptimize(map);
+                DoNotOptimize(CalculateInflectionPointSettings(overrideConfig, map, true));
+            }
+        }
+    }, 6 });
+
+    //
+    // Stat modifiers
+    //
+    for (uint8_t instanceType = 0; instanceType < DUNGEONSCALE_INSTANCE_TYPE_COUNT; ++instanceType)
+    {
+        static uint32_t const maxPlayersByType[DUNGEONSCALE_INSTANCE_TYPE_COUNT] = { 5, 10, 15, 20, 25, 40, 80, 5, 10, 25, 80 };
+        uint32_t maxPlayers = maxPlayersByType[instanceType];
+        bool isHeroic = instanceType >= DUNGEONSCALE_INSTANCE_5M_HEROIC;
+        std::string category = GetInstanceTypeName(GetInstanceType(maxPlayers, isHeroic));
+
+        cases.push_back({ "CalculateStatModifiers/" + category, [maxPlayers, isHeroic](uint64_t iterations)
+        {
+            DungeonScaleMapDescriptor map = MakeMap(1, maxPlayers, isHeroic, 1);
+            DungeonScaleCreatureDescriptor creature;
+            creature.entry = 1;
+            for (uint64_t i = 0; i < iterations; ++i)
+            {
+                DoNotOptimize(map);
+                creature.isBoss = i & 1;
+                DoNotOptimize(CalculateStatModifiers(config, map, &creature));
+            }
+        } });
+    }
+
+    cases.push_back({ "CalculateStatModifiers/per-instance overrides", [](uint64_t iterations)
+    {
+        DungeonScaleCreatureDescriptor creature;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            for (uint32_t mapId : { 409u, 568u, 43u, 533u })
+            {
+                DungeonScaleMapDescriptor map = MakeMap(mapId, 40, false, 1);
+                DoNotOptimize(map);
+                creature.isBoss = mapId & 1;
+                DoNotOptimize(CalculateStatModifiers(overrideConfig, map, &creature));
+            }
+        }
+    }, 4 });
+
+    cases.push_back({ "CalculateStatModifiers/per-creature override", [](uint64_t iterations)
+    {
+        DungeonScaleMapDescriptor map = MakeMap(409, 40, false, 1);
+        DungeonScaleCreatureDescriptor creature;
+        creature.entry = 14507;
+        creature.creatureOverride = FindCreatureStatModifierOverride(overrideConfig, creature.entry);
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(map);
+            DoNotOptimize(CalculateStatModifiers(overrideConfig, map, &creature));
+        }
+    } });
+
+    cases.push_back({ "FindCreatureStatModifierOverride", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            uint32_t entry = (i & 1) ? 14507 : 1234;
+            DoNotOptimize(entry);
+            DoNotOptimize(FindCreatureStatModifierOverride(overrideConfig, entry));
+        }
+    } });
+
+    //
+    // Damage and healing decisions
+    //
+    static std::vector<std::pair<std::string, DungeonScaleDamageHealingEvent>> const damageHealingEvents = []()
+    {
+        std::vector<std::pair<std::string, DungeonScaleDamageHealingEvent>> events;
+
+        events.push_back({ "creature->player melee", MakeEvent(-1000, 0, false, true, true, false) });
+        events.push_back({ "creature->player spell", MakeEvent(-2500, 12345, false, true, true, false) });
+        events.push_back({ "creature->creature heal", MakeEvent(3000, 12345, false, true, false, false) });
+        events.push_back({ "creature->self share damage", []() { auto e = MakeEvent(-500, 12345, false, true, false, true); e.isShareDamageAura = true; return e; }() });
+        events.push_back({ "player->creature melee", MakeEvent(-1000, 0, true, false, false, false) });
+        events.push_back({ "player->friendly creature", []() { auto e = MakeEvent(-1000, 12345, true, false, false, false); e.targetIsFriendly = true; return e; }() });
+        events.push_back({ "player->player heal", MakeEvent(2000, 12345, true, false, true, false) });
+        events.push_back({ "player->self spend health", MakeEvent(-400, 57946, true, false, true, true) });
+        events.push_back({ "player->self damage", MakeEvent(-400, 12345, true, false, true, true) });
+        events.push_back({ "pet->creature melee", []() { auto e = MakeEvent(-800, 0, false, true, false, false); e.isPlayerControlled = true; return e; }() });
+        events.push_back({ "never modify spell", MakeEvent(-5000, 1177, false, true, true, false) });
+        events.push_back({ "map not enabled", []() { auto e = MakeEvent(-1000, 0, false, true, true, false); e.mapsEnabled = false; return e; }() });
+
+        return events;
+    }();
+
+    for (auto const& [name, event] : damageHealingEvents)
+    {
+        DungeonScaleDamageHealingEvent benchEvent = event;
+        cases.push_back({ "ClassifyDamageHealing/" + name, [benchEvent](uint64_t iterations)
+        {
+            DungeonScaleDamageHealingEvent localEvent = benchEvent;
+            for (uint64_t i = 0; i < iterations; ++i)
+            {
+                DoNotOptimize(localEvent);
+                DoNotOptimize(ClassifyDamageHealing(localEvent));
+            }
+        } });
+    }
+
+    //
+    // Loot
+    //
+    cases.push_back({ "IsLootItemExemptFromScaling/scaled item", [](uint64_t iterations)
+    {
+        DungeonScaleLootItemDescriptor item;
+        item.itemId = 19019;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(item);
+            DoNotOptimize(IsLootItemExemptFromScaling(config, item));
+        }
+    } });
+
+    cases.push_back({ "IsLootItemExemptFromScaling/exception item ID", [](uint64_t iterations)
+    {
+        DungeonScaleLootItemDescriptor item;
+        item.itemId = 49635;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(item);
+            DoNotOptimize(IsLootItemExemptFromScaling(config, item));
+        }
+    } });
+
+    cases.push_back({ "IsLootItemExemptFromScaling/bind on pickup", [](uint64_t iterations)
+    {
+        DungeonScaleLootItemDescriptor item;
+        item.itemId = 19019;
+        item.isBindOnPickup = true;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(item);
+            DoNotOptimize(IsLootItemExemptFromScaling(config, item));
+        }
+    } });
+
+    //
+    // Config parsers
+    //
+    cases.push_back({ "ParseIntsFromString/loot exception IDs", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+            DoNotOptimize(ParseIntsFromString("8444, 11078, 11197, 11602, 11885, 13302, 13303, 13304, 13305, 13306, 13307, 21761, 21762, 30436, 30437, 31088, 37372, 43151, 43158, 49351, 49352, 49635"));
+    } });
+
+    cases.push_back({ "LoadMinPlayersPerDungeonId", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+            DoNotOptimize(LoadMinPlayersPerDungeonId("33 2, 43 5, 129 4, 209 3, 349 2, 389 3"));
+    } });
+
+    cases.push_back({ "LoadInflectionPointOverrides", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+            DoNotOptimize(LoadInflectionPointOverrides("229 0.4 0.0 1.5, 309 -1 0.0 1.1, 48 0.3"));
+    } });
+
+    cases.push_back({ "LoadStatModifierOverrides", [](uint64_t iterations)
+    {
+        for (uint64_t i = 0; i < iterations; ++i)
+            DoNotOptimize(LoadStatModifierOverrides("409 1.0 0.8 0.8 1.0 1.2 1.0, 568 -1 -1 -1 -1 1.35, 43 -1 1.2 1.2"));
+    } });
+
+    return cases;
+}
+
+int main(int argc, char** argv)
+{
+    std::string filter;
+    double minTimeMs = 200;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--min-time-ms") && i + 1 < argc)
+            minTimeMs = atof(argv[++i]);
+        else
+            filter = argv[i];
+    }
+
+    for (BenchCase const& benchCase : MakeCases())
+    {
+        if (!filter.empty() && benchCase.name.find(filter) == std::string::npos)
+            continue;
+
+        RunCase(benchCase, minTimeMs);
+    }
+
+    return 0;
+}
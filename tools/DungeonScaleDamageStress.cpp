@@ -0,0 +1,741 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Damage and healing stress harness for DungeonScale
+*
+* Replays a large stream of melee, spell, periodic and heal events through the DungeonScale_UnitScript hooks
+* (ModifyMeleeDamage, ModifySpellDamageTaken, ModifyPeriodicDamageAurasTick and ModifyHealReceived) with stand-in
+* units, maps and spells. Their shared body is the module's own: ModifyDamageHealing in DungeonScaleEngine.h, with
+* the early-outs, the event built for the engine's ClassifyDamageHealing and the multiplier, which this harness
+* calls through stand-in unit accessors. The mix covers player->creature, creature->player, spells that spend the
+* player's own health, player pets and summons, share-damage auras and heals.
+*
+* The lookups the hooks make on the way are kept: the string-keyed CustomData lookups of the maps' and the source
+* creature's records (GetDefault/GetCreatureInfo) and a player's reaction to the other unit (IsFriendlyTo) through
+* a faction template table and the player's reputation. Left out are the core's own damage and healing pipeline
+* around the hooks, the debug log level checks, the probes and the recorder.
+*
+* Reports events per second per core for the mixed stream, and the time spent per decision branch, as a baseline
+* before reworking the hot path. The figures are for the hook bodies only, against stand-in objects that are
+* smaller than the real units.
+*
+* Build and run from the module root (no worldserver needed):
+*
+*   g++ -std=c++20 -O2 -pthread -I src tools/DungeonScaleDamageStress.cpp src/DungeonScaleEngine.cpp -o dungeonscale_damage_stress
+*   ./dungeonscale_damage_stress [--events-millions N] [--threads N] [--seed N]
+*/
+
+#include "DungeonScaleEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+enum SimTypeId : uint8_t
+{
+    SIM_TYPEID_UNIT = 3,
+    SIM_TYPEID_PLAYER = 4
+};
+
+enum SimAuraType : uint8_t
+{
+    SIM_AURA_NONE = 0,
+    SIM_AURA_PERIODIC_DAMAGE,
+    SIM_AURA_PERIODIC_HEAL,
+    SIM_AURA_MOD_STUN,
+    SIM_AURA_SHARE_DAMAGE_PCT
+};
+
+enum SimHook : uint8_t
+{
+    SIM_HOOK_MELEE = 0,                             // ModifyMeleeDamage
+    SIM_HOOK_SPELL,                                 // ModifySpellDamageTaken
+    SIM_HOOK_PERIODIC,                              // ModifyPeriodicDamageAurasTick
+    SIM_HOOK_HEAL,                                  // ModifyHealReceived
+    SIM_HOOK_COUNT
+};
+
+static char const* const simHookNames[SIM_HOOK_COUNT] =
+{
+    "ModifyMeleeDamage",
+    "ModifySpellDamageTaken",
+    "ModifyPeriodicDamageAurasTick",
+    "ModifyHealReceived"
+};
+
+enum SimFactionTemplateId : uint8_t
+{
+    SIM_FACTION_TEMPLATE_NONE = 0,
+    SIM_FACTION_TEMPLATE_PLAYER,
+    SIM_FACTION_TEMPLATE_MONSTER,
+    SIM_FACTION_TEMPLATE_ESCORT,
+    SIM_FACTION_TEMPLATE_COUNT
+};
+
+enum SimReputationRank : uint8_t
+{
+    SIM_REP_HOSTILE = 1,
+    SIM_REP_UNFRIENDLY = 2,
+    SIM_REP_NEUTRAL = 3,
+    SIM_REP_FRIENDLY = 4
+};
+
+// stands in for DataMap (the CustomData of maps and units): polymorphic records keyed by string,
+// the hooks look the maps' and the source creature's records up by name on every scaled event
+class SimDataMap
+{
+public:
+    class Base
+    {
+    public:
+        virtual ~Base() = default;
+    };
+
+    template <class T>
+    T* Get(std::string const& key) const
+    {
+        auto iterator = container.find(key);
+        return iterator != container.end() ? dynamic_cast<T*>(iterator->second.get()) : nullptr;
+    }
+
+    template <class T>
+    T* GetDefault(std::string const& key)
+    {
+        if (T* value = Get<T>(key))
+            return value;
+
+        T* value = new T();
+        container.emplace(key, std::unique_ptr<T>(value));
+        return value;
+    }
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Base>> container;
+};
+
+// the part of DungeonScaleMapInfo the hooks read
+class SimMapInfo : public SimDataMap::Base
+{
+public:
+    bool enabled = true;
+    float worldDamageHealingMultiplier = 0.6f;
+};
+
+// the part of DungeonScaleCreatureInfo the hooks read
+class SimCreatureInfo : public SimDataMap::Base
+{
+public:
+    float damageMultiplier = 1.0f;
+};
+
+// what GetCreatureInfo returns for units without their own record
+static SimCreatureInfo const notRelevantCreatureInfo;
+
+// stands in for the Map
+class SimMap
+{
+public:
+    bool isDungeon = true;
+    SimDataMap customData;
+};
+
+// stands in for FactionTemplateEntry
+class SimFactionTemplate
+{
+public:
+    uint32_t faction = 0;
+    uint32_t ourMask = 0;
+    uint32_t friendlyMask = 0;
+    uint32_t hostileMask = 0;
+};
+
+// stands in for the player's ReputationMgr: forced reactions and standings by faction
+class SimReputation
+{
+public:
+    std::map<uint32_t, SimReputationRank> forcedRanks;
+    std::map<uint32_t, int32_t> standings;
+};
+
+// stands in for Unit
+class SimUnit
+{
+public:
+    uint64_t guid = 0;
+    SimTypeId typeId = SIM_TYPEID_UNIT;
+    bool isPet = false;
+    bool isSummon = false;
+    bool isControlledByPlayer = false;
+    bool isInWorld = true;
+    uint32_t faction = 0;                           // faction template id
+    SimMap* map = nullptr;
+    SimUnit* owner = nullptr;                       // the player controlling a pet or summon
+    SimReputation* reputation = nullptr;            // players only
+    SimDataMap customData;
+};
+
+// stands in for SpellInfo
+class SimSpell
+{
+public:
+    uint32_t id = 0;
+    bool isPositive = false;
+    SimAuraType effects[3] = {};
+};
+
+class SimEvent
+{
+public:
+    SimHook hook = SIM_HOOK_MELEE;
+    SimUnit* target = nullptr;
+    SimUnit* source = nullptr;                      // null if the caster is gone
+    SimSpell const* spellInfo = nullptr;
+    uint32_t amount = 0;
+};
+
+class SimSettings
+{
+public:
+    uint64_t events = 20000000;
+    uint32_t threads = 1;
+    uint32_t seed = 1;
+};
+
+static SimSettings settings;
+static bool EnableGlobal = true;
+
+// stands in for sFactionTemplateStore, indexed by faction template id
+static std::vector<SimFactionTemplate> factionTemplateStore;
+
+//
+// Core lookups the hooks make, see Unit::GetReactionTo and GetCreatureInfo in DungeonScale.cpp
+//
+
+static SimFactionTemplate const* GetFactionTemplate(uint32_t factionTemplateId)
+{
+    return factionTemplateId < factionTemplateStore.size() ? &factionTemplateStore[factionTemplateId] : nullptr;
+}
+
+static SimUnit const* GetCharmerOrOwnerPlayerOrPlayerItself(SimUnit const* unit)
+{
+    if (unit->typeId == SIM_TYPEID_PLAYER)
+        return unit;
+
+    return unit->owner && unit->owner->typeId == SIM_TYPEID_PLAYER ? unit->owner : nullptr;
+}
+
+static SimReputationRank GetReputationRank(SimReputation const* reputation, uint32_t faction)
+{
+    auto standing = reputation->standings.find(faction);
+    if (standing == reputation->standings.end())
+        return SIM_REP_NEUTRAL;
+
+    if (standing->second >= 3000)
+        return SIM_REP_FRIENDLY;
+
+    return standing->second < -3000 ? SIM_REP_HOSTILE : (standing->second < 0 ? SIM_REP_UNFRIENDLY : SIM_REP_NEUTRAL);
+}
+
+// the unit's faction reaction to a player: forced reaction, then the player's standing, then the template masks
+static SimReputationRank GetFactionReactionTo(SimFactionTemplate const* factionTemplate, SimUnit const* targetPlayer, SimFactionTemplate const* targetFactionTemplate)
+{
+    if (targetPlayer)
+    {
+        auto forcedRank = targetPlayer->reputation->forcedRanks.find(factionTemplate->faction);
+        if (forcedRank != targetPlayer->reputation->forcedRanks.end())
+            return forcedRank->second;
+
+        if (factionTemplate->faction)
+        {
+            SimReputationRank rank = GetReputationRank(targetPlayer->reputation, factionTemplate->faction);
+            if (rank != SIM_REP_NEUTRAL)
+                return rank;
+        }
+    }
+
+    if (factionTemplate->hostileMask & targetFactionTemplate->ourMask)
+        return SIM_REP_HOSTILE;
+
+    if (factionTemplate->friendlyMask & targetFactionTemplate->ourMask)
+        return SIM_REP_FRIENDLY;
+
+    return SIM_REP_NEUTRAL;
+}
+
+static SimReputationRank GetReactionTo(SimUnit const* unit, SimUnit const* target)
+{
+    if (unit == target)
+        return SIM_REP_FRIENDLY;
+
+    SimFactionTemplate const* factionTemplate = GetFactionTemplate(unit->faction);
+    SimFactionTemplate const* targetFactionTemplate = GetFactionTemplate(target->faction);
+    if (!factionTemplate || !targetFactionTemplate)
+        return SIM_REP_NEUTRAL;
+
+    SimUnit const* selfPlayerOwner = GetCharmerOrOwnerPlayerOrPlayerItself(unit);
+    SimUnit const* targetPlayerOwner = GetCharmerOrOwnerPlayerOrPlayerItself(target);
+
+    // players and their pets react to each other by team
+    if (selfPlayerOwner && targetPlayerOwner)
+        return (factionTemplate->friendlyMask & targetFactionTemplate->ourMask) ? SIM_REP_FRIENDLY : SIM_REP_HOSTILE;
+
+    if (selfPlayerOwner)
+        return GetFactionReactionTo(targetFactionTemplate, selfPlayerOwner, factionTemplate);
+
+    return GetFactionReactionTo(factionTemplate, targetPlayerOwner, targetFactionTemplate);
+}
+
+static bool IsFriendlyTo(SimUnit const* unit, SimUnit const* target)
+{
+    return GetReactionTo(unit, target) >= SIM_REP_FRIENDLY;
+}
+
+static SimCreatureInfo const* GetCreatureInfo(SimUnit* unit)
+{
+    if (SimCreatureInfo const* creatureInfo = unit->customData.Get<SimCreatureInfo>("DungeonScaleCreatureInfo"))
+        return creatureInfo;
+
+    return &notRelevantCreatureInfo;
+}
+
+//
+// Hook bodies, see DungeonScale_UnitScript in DungeonScale.cpp
+//
+
+static bool IsAuraWithEffectType(SimSpell const* spellInfo, SimAuraType auraType)
+{
+    if (!spellInfo)
+        return false;
+
+    for (SimAuraType effect : spellInfo->effects)
+    {
+        if (effect == auraType)
+            return true;
+    }
+
+    return false;
+}
+
+static thread_local DungeonScaleDamageHealingBranch lastBranch;   // the branch the last event took, for the per-branch pass
+
+// what the module's hook body (ModifyDamageHealing in DungeonScaleEngine.h) needs to know about the stand-ins,
+// the same questions DungeonScale_UnitScript::DamageHealingUnits answers for the real units
+class SimDamageHealingUnits
+{
+public:
+    bool IsEnabled() const { return EnableGlobal; }
+    bool IsDungeon(SimUnit* unit) const { return unit->map->isDungeon; }
+    bool IsInWorld(SimUnit* unit) const { return unit->isInWorld; }
+    bool IsPlayer(SimUnit* unit) const { return unit->typeId == SIM_TYPEID_PLAYER; }
+    bool IsCreature(SimUnit* unit) const { return unit->typeId == SIM_TYPEID_UNIT; }
+    bool IsSameUnit(SimUnit* unit, SimUnit* other) const { return unit->guid == other->guid; }
+    bool IsPlayerControlled(SimUnit* unit) const { return (unit->isPet || unit->isSummon) && unit->isControlledByPlayer; }
+    bool IsFriendlyTo(SimUnit* target, SimUnit* source) const { return ::IsFriendlyTo(target, source); }
+    bool IsShareDamageAura(SimSpell const* spellInfo) const { return IsAuraWithEffectType(spellInfo, SIM_AURA_SHARE_DAMAGE_PCT); }
+    uint32_t GetSpellId(SimSpell const* spellInfo) const { return spellInfo ? spellInfo->id : 0; }
+    SimMapInfo* GetMapInfo(SimUnit* unit) const { return unit->map->customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo"); }
+    float GetDamageMultiplier(SimUnit* unit) const { return GetCreatureInfo(unit)->damageMultiplier; }
+
+    // the module's debug logs, probes and recorder aren't modelled
+    void OnEarlyOut(char const* /*reason*/, int32_t /*amount*/) const { }
+    void OnSourceMissing() const { }
+    void OnStart(SimUnit* /*source*/, uint32_t /*spellId*/, int32_t /*amount*/) const { }
+
+    void OnDecided(SimUnit* /*source*/, SimMapInfo* /*sourceMapInfo*/, DungeonScaleDamageHealingEvent const& /*event*/,
+                   DungeonScaleDamageHealingBranch branch, float /*multiplier*/, int32_t /*result*/) const
+    {
+        lastBranch = branch;
+    }
+};
+
+static int32_t ModifyDamageHealing(SimUnit* target, SimUnit* source, int32_t amount, SimSpell const* spellInfo = nullptr)
+{
+    SimDamageHealingUnits units;
+    return ModifyDamageHealing(units, target, source, amount, spellInfo);
+}
+
+static void ModifyPeriodicDamageAurasTick(SimUnit* target, SimUnit* source, uint32_t& amount, SimSpell const* spellInfo)
+{
+    int32_t adjustedAmount = !spellInfo->isPositive ? (int32_t)amount * -1 : (int32_t)amount;
+    adjustedAmount = ModifyDamageHealing(target, source, adjustedAmount, spellInfo);
+    amount = std::abs(adjustedAmount);
+}
+
+static void ModifySpellDamageTaken(SimUnit* target, SimUnit* source, int32_t& amount, SimSpell const* spellInfo)
+{
+    int32_t adjustedAmount = !spellInfo->isPositive ? amount * -1 : amount;
+    adjustedAmount = ModifyDamageHealing(target, source, adjustedAmount, spellInfo);
+    amount = std::abs(adjustedAmount);
+}
+
+static void ModifyMeleeDamage(SimUnit* target, SimUnit* source, uint32_t& amount)
+{
+    int32_t adjustedAmount = (int32_t)amount * -1;
+    adjustedAmount = ModifyDamageHealing(target, source, adjustedAmount);
+    amount = std::abs(adjustedAmount);
+}
+
+static void ModifyHealReceived(SimUnit* target, SimUnit* source, uint32_t& amount, SimSpell const* spellInfo)
+{
+    amount = ModifyDamageHealing(target, source, amount, spellInfo);
+}
+
+static uint32_t DispatchEvent(SimEvent const& event)
+{
+    uint32_t amount = event.amount;
+
+    switch (event.hook)
+    {
+        case SIM_HOOK_MELEE:
+            ModifyMeleeDamage(event.target, event.source, amount);
+            break;
+        case SIM_HOOK_SPELL:
+        {
+            int32_t spellAmount = amount;
+            ModifySpellDamageTaken(event.target, event.source, spellAmount, event.spellInfo);
+            amount = spellAmount;
+            break;
+        }
+        case SIM_HOOK_PERIODIC:
+            ModifyPeriodicDamageAurasTick(event.target, event.source, amount, event.spellInfo);
+            break;
+        case SIM_HOOK_HEAL:
+            ModifyHealReceived(event.target, event.source, amount, event.spellInfo);
+            break;
+        default:
+            break;
+    }
+
+    return amount;
+}
+
+//
+// Event mix
+//
+
+class SimWorld
+{
+public:
+    SimMap map;
+    std::vector<SimUnit> players;
+    std::vector<SimUnit> creatures;
+    std::vector<SimUnit> pets;
+    std::vector<SimReputation> reputations;
+
+    SimSpell meleeSpell;                            // unused, melee has no spell
+    SimSpell damageSpell{ 12345, false, { SIM_AURA_NONE } };
+    SimSpell dotSpell{ 12346, false, { SIM_AURA_PERIODIC_DAMAGE } };
+    SimSpell healSpell{ 12347, true, { SIM_AURA_NONE } };
+    SimSpell hotSpell{ 12348, true, { SIM_AURA_PERIODIC_HEAL } };
+    SimSpell stunSpell{ 12349, false, { SIM_AURA_MOD_STUN, SIM_AURA_PERIODIC_DAMAGE } };
+    SimSpell lifeTapSpell{ 57946, false, { SIM_AURA_NONE } };       // Life Tap (Rank 8), spends the player's health
+    SimSpell selfDamageSpell{ 12350, false, { SIM_AURA_NONE } };    // e.g. a trinket or environmental backlash
+    SimSpell shareDamageSpell{ 12351, false, { SIM_AURA_PERIODIC_DAMAGE, SIM_AURA_SHARE_DAMAGE_PCT } };
+    SimSpell twinEmpathySpell{ 1177, false, { SIM_AURA_SHARE_DAMAGE_PCT } };
+};
+
+// a 25-man raid with pets, fighting a room of creatures
+static void CreateWorld(SimWorld& world)
+{
+    uint64_t guid = 1;
+
+    // the records are created up front, the replay threads only look them up
+    world.map.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+
+    // the players' template, the raid's creatures (no reputation faction) and an escort the players are exalted with
+    factionTemplateStore.resize(SIM_FACTION_TEMPLATE_COUNT);
+    factionTemplateStore[SIM_FACTION_TEMPLATE_PLAYER] = { 469, 0x1, 0x1, 0x8 };
+    factionTemplateStore[SIM_FACTION_TEMPLATE_MONSTER] = { 0, 0x8, 0x0, 0x1 };
+    factionTemplateStore[SIM_FACTION_TEMPLATE_ESCORT] = { 1050, 0x0, 0x0, 0x0 };
+
+    // every player has a reputation list the size of a levelled character's
+    world.players.reserve(25);
+    world.reputations.resize(25);
+
+    for (uint32_t i = 0; i < 25; ++i)
+    {
+        SimReputation& reputation = world.reputations[i];
+        for (uint32_t faction = 21; faction < 21 + 80; ++faction)
+            reputation.standings[faction * 13] = (int32_t)(faction * 97 % 6000) - 1000;
+
+        reputation.standings[1050] = 42000;
+        reputation.forcedRanks[1077] = SIM_REP_FRIENDLY;
+
+        SimUnit& player = world.players.emplace_back();
+        player.guid = guid++;
+        player.typeId = SIM_TYPEID_PLAYER;
+        player.faction = SIM_FACTION_TEMPLATE_PLAYER;
+        player.map = &world.map;
+        player.reputation = &reputation;
+    }
+
+    world.creatures.reserve(40);
+
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        SimUnit& creature = world.creatures.emplace_back();
+        creature.guid = guid++;
+        creature.faction = SIM_FACTION_TEMPLATE_MONSTER;
+        creature.map = &world.map;
+        creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo")->damageMultiplier = 0.4f + 0.01f * i;
+    }
+
+    world.pets.reserve(8);
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        SimUnit& pet = world.pets.emplace_back();
+        pet.guid = guid++;
+        pet.isPet = i < 5;
+        pet.isSummon = i >= 5;
+        pet.isControlledByPlayer = true;
+        pet.faction = SIM_FACTION_TEMPLATE_PLAYER;
+        pet.map = &world.map;
+        pet.owner = &world.players[i];
+    }
+}
+
+class SimEventKind
+{
+public:
+    char const* name;
+    float weight;                                   // share of the stream
+};
+
+static std::vector<SimEvent> CreateEvents(SimWorld& world, uint32_t count, std::mt19937& rng)
+{
+    // weights loosely follow a raid boss fight: mostly melee and spells both ways, lots of healing
+    static SimEventKind const kinds[] =
+    {
+        { "creature->player melee",             30.0f },
+        { "creature->player spell",             10.0f },
+        { "creature->player periodic",           6.0f },
+        { "player->creature melee",             14.0f },
+        { "player->creature spell",             12.0f },
+        { "player->creature periodic",           5.0f },
+        { "player->player heal",                10.0f },
+        { "player->player periodic heal",        4.0f },
+        { "creature->creature heal",             2.0f },
+        { "pet->creature melee",                 4.0f },
+        { "pet->creature spell",                 1.0f },
+        { "player spends own health",            1.0f },
+        { "player damages self",                 0.5f },
+        { "creature share-damage aura",          0.5f },
+        { "player->friendly creature",           0.5f },
+        { "periodic from a despawned caster",    0.5f },
+        { "never-modify spell",                  0.2f },
+    };
+
+    std::vector<float> weights;
+    for (SimEventKind const& kind : kinds)
+        weights.push_back(kind.weight);
+
+    std::discrete_distribution<uint32_t> kindDistribution(weights.begin(), weights.end());
+    auto pick = [&rng](std::vector<SimUnit>& units) { return &units[std::uniform_int_distribution<size_t>(0, units.size() - 1)(rng)]; };
+    auto amount = [&rng]() { return std::uniform_int_distribution<uint32_t>(100, 20000)(rng); };
+
+    // a friendly creature, e.g. an escort or a mind-controlled add
+    static SimUnit friendlyCreature;
+    friendlyCreature.guid = 100000;
+    friendlyCreature.faction = SIM_FACTION_TEMPLATE_ESCORT;
+    friendlyCreature.map = &world.map;
+
+    std::vector<SimEvent> events;
+    events.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        SimEvent event;
+        event.amount = amount();
+
+        switch (kindDistribution(rng))
+        {
+            case 0:  event = { SIM_HOOK_MELEE,    pick(world.players),   pick(world.creatures), nullptr,                  event.amount }; break;
+            case 1:  event = { SIM_HOOK_SPELL,    pick(world.players),   pick(world.creatures), &world.damageSpell,       event.amount }; break;
+            case 2:  event = { SIM_HOOK_PERIODIC, pick(world.players),   pick(world.creatures), &world.dotSpell,          event.amount }; break;
+            case 3:  event = { SIM_HOOK_MELEE,    pick(world.creatures), pick(world.players),   nullptr,                  event.amount }; break;
+            case 4:  event = { SIM_HOOK_SPELL,    pick(world.creatures), pick(world.players),   &world.damageSpell,       event.amount }; break;
+            case 5:  event = { SIM_HOOK_PERIODIC, pick(world.creatures), pick(world.players),   &world.stunSpell,         event.amount }; break;
+            case 6:  event = { SIM_HOOK_HEAL,     pick(world.players),   pick(world.players),   &world.healSpell,         event.amount }; break;
+            case 7:  event = { SIM_HOOK_PERIODIC, pick(world.players),   pick(world.players),   &world.hotSpell,          event.amount }; break;
+            case 8:  event = { SIM_HOOK_HEAL,     pick(world.creatures), pick(world.creatures), &world.healSpell,         event.amount }; break;
+            case 9:  event = { SIM_HOOK_MELEE,    pick(world.creatures), pick(world.pets),      nullptr,                  event.amount }; break;
+            case 10: event = { SIM_HOOK_SPELL,    pick(world.creatures), pick(world.pets),      &world.damageSpell,       event.amount }; break;
+            case 11: { SimUnit* player = pick(world.players); event = { SIM_HOOK_SPELL, player, player, &world.lifeTapSpell, event.amount }; break; }
+            case 12: { SimUnit* player = pick(world.players); event = { SIM_HOOK_SPELL, player, player, &world.selfDamageSpell, event.amount }; break; }
+            case 13: { SimUnit* creature = pick(world.creatures); event = { SIM_HOOK_PERIODIC, creature, creature, &world.shareDamageSpell, event.amount }; break; }
+            case 14: event = { SIM_HOOK_SPELL,    &friendlyCreature,     pick(world.players),   &world.damageSpell,       event.amount }; break;
+            case 15: event = { SIM_HOOK_PERIODIC, pick(world.players),   nullptr,               &world.dotSpell,          event.amount }; break;
+            default: event = { SIM_HOOK_SPELL,    pick(world.players),   pick(world.creatures), &world.twinEmpathySpell,  event.amount }; break;
+        }
+
+        events.push_back(event);
+    }
+
+    return events;
+}
+
+//
+// Measurement
+//
+
+// replays the events until the requested number has been dispatched, returns the elapsed ns
+static double Replay(std::vector<SimEvent> const& events, uint64_t eventCount, uint64_t& checksum)
+{
+    auto start = Clock::now();
+
+    uint64_t sum = 0;
+    for (uint64_t dispatched = 0; dispatched < eventCount; )
+    {
+        for (size_t i = 0; i < events.size() && dispatched < eventCount; ++i, ++dispatched)
+            sum += DispatchEvent(events[i]);
+    }
+
+    checksum += sum;
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        auto nextValue = [&]() { return i + 1 < argc ? strtoull(argv[++i], nullptr, 10) : 0ull; };
+
+        if (!strcmp(argv[i], "--events-millions"))
+            settings.events = std::max(1ull, nextValue()) * 1000000;
+        else if (!strcmp(argv[i], "--threads"))
+            settings.threads = std::max(1ull, nextValue());
+        else if (!strcmp(argv[i], "--seed"))
+            settings.seed = nextValue();
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    std::mt19937 rng(settings.seed);
+    SimWorld world;
+    CreateWorld(world);
+
+    // large enough to defeat the branch predictor learning the sequence, small enough to stay in cache like a live server's hot units
+    std::vector<SimEvent> events = CreateEvents(world, 1 << 20, rng);
+
+    //
+    // Mixed stream, one copy per thread
+    //
+    std::vector<double> threadNs(settings.threads);
+    std::vector<uint64_t> threadChecksums(settings.threads);
+    std::vector<std::thread> threads;
+
+    auto start = Clock::now();
+    for (uint32_t thread = 0; thread < settings.threads; ++thread)
+    {
+        threads.emplace_back([&, thread]()
+        {
+            threadNs[thread] = Replay(events, settings.events, threadChecksums[thread]);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    double wallNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    uint64_t checksum = 0;
+    double slowestThreadNs = 0;
+    for (uint32_t thread = 0; thread < settings.threads; ++thread)
+    {
+        checksum += threadChecksums[thread];
+        slowestThreadNs = std::max(slowestThreadNs, threadNs[thread]);
+    }
+
+    printf("Mixed stream: %llu events x %u thread(s) in %.2fs\n", (unsigned long long)settings.events, settings.threads, wallNs / 1e9);
+    printf("  %.1fM events/s per core, %.2f ns/event, %.1fM events/s total\n",
+        settings.events / (slowestThreadNs / 1e9) / 1e6,
+        slowestThreadNs / settings.events,
+        settings.events * settings.threads / (wallNs / 1e9) / 1e6
+    );
+    printf("  (the hook bodies with their CustomData and faction lookups, against stand-in units; the core's damage\n"
+           "   pipeline around the hooks, the debug log checks, the probes and the recorder are not included)\n\n");
+
+    //
+    // Per branch: group the events by the branch they take and replay each group on its own
+    //
+    std::vector<SimEvent> eventsByBranch[DUNGEONSCALE_DAMAGE_HEALING_BRANCH_COUNT];
+    uint64_t hookCounts[SIM_HOOK_COUNT] = {};
+
+    for (SimEvent const& event : events)
+    {
+        checksum += DispatchEvent(event);
+        eventsByBranch[lastBranch].push_back(event);
+        ++hookCounts[event.hook];
+    }
+
+    printf("Hook mix:\n");
+    for (uint8_t hook = 0; hook < SIM_HOOK_COUNT; ++hook)
+        printf("  %-32s %6.2f%%\n", simHookNames[hook], 100.0 * hookCounts[hook] / events.size());
+    printf("\n");
+
+    double branchNs[DUNGEONSCALE_DAMAGE_HEALING_BRANCH_COUNT] = {};
+    double totalBranchNs = 0;
+
+    for (uint8_t branch = 0; branch < DUNGEONSCALE_DAMAGE_HEALING_BRANCH_COUNT; ++branch)
+    {
+        if (eventsByBranch[branch].empty())
+            continue;
+
+        // replay in proportion to the branch's share of the stream, at least a million times
+        uint64_t replayCount = std::max<uint64_t>(1000000, settings.events * eventsByBranch[branch].size() / events.size());
+        branchNs[branch] = Replay(eventsByBranch[branch], replayCount, checksum) / replayCount;
+        totalBranchNs += branchNs[branch] * eventsByBranch[branch].size();
+    }
+
+    printf("%8s %10s %12s  %s\n", "share", "ns/event", "time share", "branch");
+    for (uint8_t branch = 0; branch < DUNGEONSCALE_DAMAGE_HEALING_BRANCH_COUNT; ++branch)
+    {
+        if (eventsByBranch[branch].empty())
+            continue;
+
+        printf("%7.2f%% %10.2f %11.2f%%  %s\n",
+            100.0 * eventsByBranch[branch].size() / events.size(),
+            branchNs[branch],
+            100.0 * branchNs[branch] * eventsByBranch[branch].size() / totalBranchNs,
+            GetDamageHealingBranchName((DungeonScaleDamageHealingBranch)branch)
+        );
+    }
+
+    printf("\n(checksum %llu)\n", (unsigned long long)checksum);
+
+    return 0;
+}
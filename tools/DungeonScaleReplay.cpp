@@ -0,0 +1,334 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Offline replayer for DungeonScale recordings
+*
+* Reads a recording written by the module (DungeonScale.Recorder.Enable, `.dungeonscale record`) and runs each
+* record back through the scaling engine with the config stored in the recording:
+*
+*   MapRescale        the world health and damage/healing multipliers
+*   CreatureRescale   the default multiplier and the health, mana, armor, damage and CC duration multipliers
+*   DamageHealing     the multiplier decision branch and the resulting amount
+*
+* Anything that doesn't match what the server recorded is listed, and the exit code is 1. Records from before the
+* last config reload in the recording are listed but not checked, the recording only holds the config the instance
+* had when it was written. Other modules changing the multipliers through the DungeonScaleModuleScript hooks also
+* show up as mismatches.
+*
+* Build and run from the module root (no worldserver needed):
+*
+*   g++ -std=c++20 -O2 -I src tools/DungeonScaleReplay.cpp src/DungeonScaleRecorder.cpp src/DungeonScaleEngine.cpp -o dungeonscale_replay
+*   ./dungeonscale_replay <recording.dsrec> [--verbose] [--tolerance N] [--max-mismatches N]
+*/
+
+#include "DungeonScaleEngine.h"
+#include "DungeonScaleRecorder.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+class ReplaySettings
+{
+public:
+    std::string path;
+    bool verbose = false;                           // print every record
+    double tolerance = 1e-4;                        // relative difference allowed between recorded and replayed values
+    uint32_t maxMismatches = 20;                    // mismatches printed, all of them are counted
+};
+
+class ReplayTypeStats
+{
+public:
+    uint64_t records = 0;
+    uint64_t checked = 0;
+    uint64_t mismatches = 0;
+    double replayNs = 0;
+};
+
+static ReplaySettings settings;
+static ReplayTypeStats typeStats[DUNGEONSCALE_RECORD_TYPE_COUNT];
+
+// the values a record is compared on, recorded next to replayed
+class ReplayComparison
+{
+public:
+    char const* names[6] = {};
+    float recorded[6] = {};
+    float replayed[6] = {};
+    uint8_t count = 0;
+
+    void Add(char const* name, float recordedValue, float replayedValue)
+    {
+        names[count] = name;
+        recorded[count] = recordedValue;
+        replayed[count] = replayedValue;
+        count++;
+    }
+
+    bool Matches() const
+    {
+        for (uint8_t i = 0; i < count; ++i)
+            if (std::fabs(recorded[i] - replayed[i]) > settings.tolerance * std::max(1.0f, std::fabs(recorded[i])))
+                return false;
+
+        return true;
+    }
+};
+
+static void PrintRecord(uint32_t index, DungeonScaleRecord const& record, char const* status)
+{
+    printf("#%-7u %9.3fs %-16s id %-6u players %-3u %s",
+        index,
+        record.time / 1000.0,
+        GetRecordTypeName((DungeonScaleRecordType)record.type),
+        record.id,
+        record.playerCount,
+        status
+    );
+}
+
+static void PrintComparison(ReplayComparison const& comparison)
+{
+    for (uint8_t i = 0; i < comparison.count; ++i)
+    {
+        printf(" | %s %g", comparison.names[i], comparison.recorded[i]);
+
+        if (comparison.recorded[i] != comparison.replayed[i])
+            printf(" (replay %g)", comparison.replayed[i]);
+    }
+
+    printf("\n");
+}
+
+// the multiplier part of DungeonScale_AllCreatureScript::ModifyCreatureAttributes
+static void ReplayCreatureRescale(DungeonScaleRecordingHeader const& header, DungeonScaleEngineConfig const& config,
+                                  std::map<uint32_t, DungeonScaleStatModifiers> const& creatureOverrides,
+                                  DungeonScaleRecord const& record, ReplayComparison& comparison)
+{
+    DungeonScaleMapDescriptor mapDescriptor = GetRecordingMapDescriptor(header, record.playerCount);
+
+    DungeonScaleCreatureDescriptor creatureDescriptor;
+    creatureDescriptor.entry = record.id;
+    creatureDescriptor.isBoss = record.flags & DUNGEONSCALE_RECORD_FLAG_BOSS;
+
+    auto creatureOverrideIterator = creatureOverrides.find(record.id);
+    if (creatureOverrideIterator != creatureOverrides.end())
+        creatureDescriptor.creatureOverride = &creatureOverrideIterator->second;
+
+    DungeonScaleInflectionPointSettings inflectionPointSettings = CalculateInflectionPointSettings(config, mapDescriptor, creatureDescriptor.isBoss);
+    float defaultMultiplier = CalculateDefaultMultiplier(mapDescriptor, inflectionPointSettings);
+    DungeonScaleStatModifiers statModifiers = CalculateStatModifiers(config, mapDescriptor, &creatureDescriptor);
+
+    DungeonScaleCreatureMultipliers multipliers = CalculateCreatureMultipliers(config, defaultMultiplier, statModifiers, record.flags & DUNGEONSCALE_RECORD_FLAG_HAS_MANA);
+
+    comparison.Add("default", record.values[0], defaultMultiplier);
+    comparison.Add("health", record.values[1], multipliers.health);
+    comparison.Add("mana", record.values[2], multipliers.mana);
+    comparison.Add("armor", record.values[3], multipliers.armor);
+    comparison.Add("damage", record.values[4], multipliers.damage);
+    comparison.Add("cc", record.values[5], multipliers.ccDuration);
+}
+
+// mirrors UpdateWorldMultipliers
+static void ReplayMapRescale(DungeonScaleRecordingHeader const& header, DungeonScaleEngineConfig const& config, DungeonScaleRecord const& record, ReplayComparison& comparison)
+{
+    DungeonScaleMapDescriptor mapDescriptor = GetRecordingMapDescriptor(header, record.playerCount);
+
+    float defaultMultiplier = CalculateDefaultMultiplier(mapDescriptor, CalculateInflectionPointSettings(config, mapDescriptor));
+    DungeonScaleStatModifiers statModifiers = CalculateStatModifiers(config, mapDescriptor);
+
+    comparison.Add("world health", record.values[0], defaultMultiplier * statModifiers.global * statModifiers.health);
+    comparison.Add("world damage", record.values[1], defaultMultiplier * statModifiers.global * statModifiers.damage);
+}
+
+// mirrors DungeonScale_UnitScript::_Modify_Damage_Healing, the multiplier itself comes from the recording
+static void ReplayDamageHealing(DungeonScaleRecord const& record, ReplayComparison& comparison)
+{
+    DungeonScaleDamageHealingEvent damageHealingEvent;
+    damageHealingEvent.amount = (int32_t)record.values[0];
+    damageHealingEvent.spellId = record.id;
+    UnpackDamageHealingEventFlags(record.flags, damageHealingEvent);
+
+    DungeonScaleDamageHealingBranch branch = ClassifyDamageHealing(damageHealingEvent);
+    // the branches from PLAYER_SELF_DAMAGE on multiply the amount
+    float multiplier = branch >= DUNGEONSCALE_DAMAGE_HEALING_PLAYER_SELF_DAMAGE ? record.values[1] : 1.0f;
+
+    comparison.Add("branch", record.detail, branch);
+    comparison.Add("multiplier", record.values[1], multiplier);
+    comparison.Add("result", record.values[2], (float)(int32_t)(damageHealingEvent.amount * multiplier));
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--verbose"))
+            settings.verbose = true;
+        else if (!strcmp(argv[i], "--tolerance") && i + 1 < argc)
+            settings.tolerance = strtod(argv[++i], nullptr);
+        else if (!strcmp(argv[i], "--max-mismatches") && i + 1 < argc)
+            settings.maxMismatches = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        else if (argv[i][0] != '-' && settings.path.empty())
+            settings.path = argv[i];
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (settings.path.empty())
+    {
+        fprintf(stderr, "Usage: %s <recording.dsrec> [--verbose] [--tolerance N] [--max-mismatches N]\n", argv[0]);
+        return 1;
+    }
+
+    DungeonScaleRecordingHeader header;
+    std::vector<DungeonScaleRecord> records;
+    std::string error;
+
+    if (!LoadRecording(settings.path, header, records, error))
+    {
+        fprintf(stderr, "%s: %s\n", settings.path.c_str(), error.c_str());
+        return 1;
+    }
+
+    time_t startTime = (time_t)header.startTime;
+    char startTimeText[32];
+    strftime(startTimeText, sizeof(startTimeText), "%Y-%m-%d %H:%M:%S", localtime(&startTime));
+
+    printf("Map %u-%u | %s (max %u players) | recorded from %s\n",
+        header.mapId,
+        header.instanceId,
+        GetInstanceTypeName(GetInstanceType(header.maxPlayers, header.isHeroic)),
+        header.maxPlayers,
+        startTimeText
+    );
+    printf("%u record(s), %llu older record(s) overwritten, %llu creature record(s) dropped\n\n",
+        header.recordCount,
+        (unsigned long long)header.droppedRecords,
+        (unsigned long long)header.droppedCreatureRecords
+    );
+
+    // the creature table filled up, creatures of entries it never got an override for are replayed without one
+    if (header.droppedCreatureRecords)
+        printf("The recording's creature table was full, rescales of creatures with their own stat modifiers may not match.\n\n");
+
+    DungeonScaleEngineConfig config = GetRecordingEngineConfig(header);
+
+    // the stored config only applies from the last reload on
+    uint32_t firstCheckedRecord = 0;
+    for (uint32_t index = 0; index < records.size(); ++index)
+        if (records[index].type == DUNGEONSCALE_RECORD_MAP_RESCALE && (records[index].flags & DUNGEONSCALE_RECORD_FLAG_CONFIG_RELOADED))
+            firstCheckedRecord = index;
+
+    if (firstCheckedRecord)
+        printf("The config was reloaded during the recording, records before #%u are not checked.\n\n", firstCheckedRecord);
+
+    std::map<uint32_t, DungeonScaleStatModifiers> creatureOverrides;
+    uint64_t mismatches = 0;
+
+    for (uint32_t index = 0; index < records.size(); ++index)
+    {
+        DungeonScaleRecord const& record = records[index];
+        if (record.type >= DUNGEONSCALE_RECORD_TYPE_COUNT)
+        {
+            fprintf(stderr, "Record #%u has unknown type %u, stopping.\n", index, record.type);
+            return 1;
+        }
+
+        ReplayTypeStats& stats = typeStats[record.type];
+        stats.records++;
+
+        ReplayComparison comparison;
+        bool isChecked = index >= firstCheckedRecord;
+
+        Clock::time_point replayStart = Clock::now();
+
+        switch (record.type)
+        {
+            case DUNGEONSCALE_RECORD_MAP_RESCALE:
+                if (record.flags & DUNGEONSCALE_RECORD_FLAG_WORLD_SCALED)
+                    ReplayMapRescale(header, config, record, comparison);
+                else
+                    isChecked = false;
+                break;
+            case DUNGEONSCALE_RECORD_CREATURE_OVERRIDE:
+                creatureOverrides[record.id] = DungeonScaleStatModifiers(record.values[0], record.values[1], record.values[2], record.values[3], record.values[4], record.values[5]);
+                isChecked = false;
+                break;
+            case DUNGEONSCALE_RECORD_CREATURE_RESCALE:
+                ReplayCreatureRescale(header, config, creatureOverrides, record, comparison);
+                break;
+            case DUNGEONSCALE_RECORD_DAMAGE_HEALING:
+                ReplayDamageHealing(record, comparison);
+                break;
+            default:
+                isChecked = false;
+                break;
+        }
+
+        stats.replayNs += std::chrono::duration<double, std::nano>(Clock::now() - replayStart).count();
+
+        bool isMismatch = isChecked && !comparison.Matches();
+        stats.checked += isChecked;
+        stats.mismatches += isMismatch;
+
+        if (isMismatch && mismatches++ < settings.maxMismatches)
+        {
+            PrintRecord(index, record, "MISMATCH");
+            PrintComparison(comparison);
+        }
+        else if (settings.verbose)
+        {
+            PrintRecord(index, record, isMismatch ? "MISMATCH" : isChecked ? "ok" : "-");
+            PrintComparison(comparison);
+        }
+    }
+
+    if (mismatches > settings.maxMismatches)
+        printf("... %llu more mismatch(es)\n", (unsigned long long)(mismatches - settings.maxMismatches));
+
+    printf("\n%-18s %10s %10s %10s %12s\n", "Record", "count", "checked", "mismatch", "replay ns");
+    for (uint8_t type = 0; type < DUNGEONSCALE_RECORD_TYPE_COUNT; ++type)
+    {
+        ReplayTypeStats const& stats = typeStats[type];
+        printf("%-18s %10llu %10llu %10llu %12.1f\n",
+            GetRecordTypeName((DungeonScaleRecordType)type),
+            (unsigned long long)stats.records,
+            (unsigned long long)stats.checked,
+            (unsigned long long)stats.mismatches,
+            stats.records ? stats.replayNs / stats.records : 0.0
+        );
+    }
+
+    return mismatches ? 1 : 0;
+}
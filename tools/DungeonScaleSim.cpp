@@ -0,0 +1,1241 @@
+/*
+* Copyright (C) 2025 Nathan Handley <https://github.com/NathanHandley/>
+* Copyright (C) 2018 AzerothCore <http://www.azerothcore.org>
+* Copyright (C) 2012 CVMagic <http://www.trinitycore.org/f/topic/6551-vas-autobalance/>
+* Copyright (C) 2008-2010 TrinityCore <http://www.trinitycore.org/>
+* Copyright (C) 2006-2009 ScriptDev2 <https://scriptdev2.svn.sourceforge.net/>
+* Copyright (C) 1985-2010 KalCorp  <http://vasserver.dyndns.org/>
+*
+* This program is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 2 of the License, or (at your
+* option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+* more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+* Instance lifecycle simulator for DungeonScale
+*
+* Drives the module's map, creature and player hook flow against stand-in instances, creatures and players,
+* with the scaling engine doing the actual math. Each simulated instance runs a group through its route:
+* pulls, boss summon storms, deaths and respawns, players joining and leaving mid-combat, and periodic config
+* reloads. The hook bodies mirror DungeonScale.cpp (UpdateMapDataIfNeeded, UpdateMapPlayerStats,
+* ResetCreatureIfNeeded with DungeonScale.Rescale.*, ModifyCreatureAttributes) minus the AzerothCore calls.
+* The per-update costs of the real hooks are kept: the string-keyed CustomData lookups of the map and creature
+* records, and the player proximity check against players and creatures placed on a 2-D route.
+*
+* Reports hook calls per second, rescale-wave latency percentiles (simulated time from the trigger until every
+* due creature is rescaled, and the CPU time the wave cost) and peak memory. The CPU figures are the module's
+* share only, on one thread and against stand-ins that are smaller than the real Creature and Player objects:
+* use them to compare settings and module versions, not as the load of a whole worldserver.
+*
+* Build and run from the module root (no worldserver needed):
+*
+*   g++ -std=c++20 -O2 -I src tools/DungeonScaleSim.cpp src/DungeonScaleEngine.cpp -o dungeonscale_sim
+*   ./dungeonscale_sim [--instances-scale N] [--seconds N] [--tick-ms N] [--reload-every N] [--max-per-tick N] [--no-defer] [--exact-distance-check] [--no-summon-profiles] [--seed N]
+*
+* --exact-distance-check skips the per-tick player bounds, so every out-of-date creature checks its distance to every
+* player on every update, to compare the two.
+*
+* --no-summon-profiles turns off the summon profile fast path (_applySummonProfile), so every summon of a storm takes
+* the full OnBeforeCreatureSelectLevel path and computes its own stat inputs, to compare the two.
+*/
+
+#include "DungeonScaleEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <malloc.h>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <sys/resource.h>
+#include <unordered_map>
+#include <vector>
+
+// track live and peak heap bytes, the simulation is single-threaded
+// the hook bodies allocate on every CustomData lookup (the keys don't fit the small string buffer), so this is kept cheap
+static int64_t liveHeapBytes = 0;
+static int64_t peakHeapBytes = 0;
+
+void* operator new(std::size_t size)
+{
+    void* memory = std::malloc(size ? size : 1);
+    if (!memory)
+        throw std::bad_alloc();
+
+    liveHeapBytes += malloc_usable_size(memory);
+    peakHeapBytes = std::max(peakHeapBytes, liveHeapBytes);
+
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+// not inlined, so the compiler doesn't pair the free() in here with the callers' operator new and warn about a mismatch
+__attribute__((noinline)) void operator delete(void* memory) noexcept
+{
+    if (!memory)
+        return;
+
+    liveHeapBytes -= malloc_usable_size(memory);
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+using Clock = std::chrono::steady_clock;
+
+enum SimHook : uint8_t
+{
+    SIM_HOOK_ON_ALL_CREATURE_UPDATE = 0,
+    SIM_HOOK_ON_CREATURE_ADD_WORLD,
+    SIM_HOOK_ON_CREATURE_REMOVE_WORLD,
+    SIM_HOOK_ON_PLAYER_ENTER_ALL,
+    SIM_HOOK_ON_PLAYER_LEAVE_ALL,
+    SIM_HOOK_ON_PLAYER_ENTER_COMBAT,
+    SIM_HOOK_ON_PLAYER_LEAVE_COMBAT,
+    SIM_HOOK_UPDATE_MAP_DATA,                       // UpdateMapDataIfNeeded calls that reconfigured the map
+    SIM_HOOK_MODIFY_CREATURE_ATTRIBUTES,
+    SIM_HOOK_ON_BEFORE_CREATURE_SELECT_LEVEL,
+    SIM_HOOK_COUNT
+};
+
+static char const* const simHookNames[SIM_HOOK_COUNT] =
+{
+    "OnAllCreatureUpdate",
+    "OnCreatureAddWorld",
+    "OnCreatureRemoveWorld",
+    "OnPlayerEnterAll",
+    "OnPlayerLeaveAll",
+    "OnPlayerEnterCombat",
+    "OnPlayerLeaveCombat",
+    "UpdateMapDataIfNeeded (reconfigured)",
+    "ModifyCreatureAttributes",
+    "OnBeforeCreatureSelectLevel"
+};
+
+enum SimWaveTrigger : uint8_t
+{
+    SIM_WAVE_NONE = 0,
+    SIM_WAVE_PLAYER_COUNT,
+    SIM_WAVE_CONFIG_RELOAD,
+    SIM_WAVE_MAP_CREATED,
+    SIM_WAVE_TRIGGER_COUNT
+};
+
+static char const* const simWaveTriggerNames[SIM_WAVE_TRIGGER_COUNT] =
+{
+    "none",
+    "player count change",
+    "config reload",
+    "map created"
+};
+
+class SimSettings
+{
+public:
+    uint32_t instancesScale = 1;                    // multiplies the default instance mix
+    uint32_t seconds = 600;                         // simulated time
+    uint32_t tickMs = 100;                          // world update interval
+    uint32_t reloadEverySeconds = 120;              // 0 = never
+    uint32_t rescaleMaxPerTick = 25;                // DungeonScale.Rescale.MaxPerTick
+    bool rescaleDeferDistant = true;                // DungeonScale.Rescale.DeferDistant
+    bool exactDistanceCheck = false;                // check every player's distance instead of the per-tick player bounds
+    bool summonProfiles = true;                     // reuse the level and stat inputs of an identical earlier summon
+    uint32_t seed = 1;
+};
+
+// the instance's visibility range, which also widens the per-tick player bounds
+static constexpr float SIM_VISIBILITY_RANGE = 170.0f;
+
+class SimPoint
+{
+public:
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+// stands in for DataMap (the CustomData of maps and creatures): polymorphic records keyed by string,
+// the module looks them up by name several times per creature update
+class SimDataMap
+{
+public:
+    class Base
+    {
+    public:
+        virtual ~Base() = default;
+    };
+
+    template <class T>
+    T* Get(std::string const& key) const
+    {
+        auto iterator = container.find(key);
+        return iterator != container.end() ? dynamic_cast<T*>(iterator->second.get()) : nullptr;
+    }
+
+    template <class T>
+    T* GetDefault(std::string const& key)
+    {
+        if (T* value = Get<T>(key))
+            return value;
+
+        T* value = new T();
+        container.emplace(key, std::unique_ptr<T>(value));
+        return value;
+    }
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Base>> container;
+};
+
+// the part of DungeonScaleCreatureInfo the creature update path reads
+class SimCreatureInfo : public SimDataMap::Base
+{
+public:
+    bool isRelevant = true;
+    bool isRescaleDeferred = false;
+    bool isBrandNew = false;                        // between OnBeforeCreatureSelectLevel and the first stat pass
+    bool isBoss = false;
+    bool isBossResolved = false;
+    uint8_t unmodifiedLevel = 0;
+    uint8_t selectedLevel = 0;
+    uint64_t mapConfigTime = 1;
+    DungeonScaleCreatureMultipliers multipliers;
+};
+
+// what the first summon of an entry by a given summoner resolved to, see DungeonScaleSummonProfile
+class SimSummonProfile
+{
+public:
+    uint64_t mapConfigTime = 0;
+    uint8_t adjustedPlayerCount = 0;
+    uint8_t spawnLevel = 0;
+    uint8_t unmodifiedLevel = 0;
+    bool isBoss = false;
+    bool hasStats = false;
+    float defaultMultiplier = 1.0f;
+    DungeonScaleStatModifiers statModifiers;
+};
+
+// the part of DungeonScaleMapInfo the creature update path reads, the rest is kept in SimInstance
+class SimMapInfo : public SimDataMap::Base
+{
+public:
+    bool isDormant = false;
+    uint64_t globalConfigTime = 1;                  // 1 until the map is configured for the first time
+    uint64_t mapConfigTime = 1;
+    std::unordered_map<uint64_t, SimSummonProfile> summonProfiles; // keyed by (summon entry << 32 | summoner)
+};
+
+class SimCreature
+{
+public:
+    uint32_t entry = 0;
+    uint8_t level = 0;                              // the level the core would spawn it at
+    uint32_t summoner = UINT32_MAX;                 // index of the summoning boss in the instance's creatures
+    float position = 0.0f;                          // 0..1 along the instance's route
+    SimPoint point;                                 // where that is on the map
+    bool isBoss = false;
+    bool isSummon = false;
+    bool isAlive = true;
+    bool isInCombat = false;
+    bool hasMana = false;
+    uint64_t despawnTimeMs = 0;                     // dead summons leave the world at this time
+    SimDataMap customData;
+};
+
+// stands in for the instance map
+class SimInstance
+{
+public:
+    DungeonScaleMapDescriptor map;
+    SimDataMap customData;
+    std::vector<SimCreature> creatures;
+    uint8_t players = 0;
+    float groupPosition = 0.0f;                     // 0..1 along the route, the players spread out around it
+    float routeLength = 0.0f;                       // yards
+    std::vector<SimPoint> playerPoints;
+
+    uint8_t playerCount = 0;
+    uint8_t minPlayers = 1;
+    uint8_t pendingAdjustedPlayerCount = 0;
+    uint64_t pendingAdjustedPlayerCountTime = 0;
+    bool combatLocked = false;
+    uint8_t combatLockMinPlayers = 0;
+
+    SimWaveTrigger staleTrigger = SIM_WAVE_NONE;   // why mapConfigTime was last invalidated
+
+    uint64_t rescaleTickTime = UINT64_MAX;
+    uint32_t rescalesThisTick = 0;
+    uint32_t closeRescalesRefused = 0;
+    uint32_t closeRescalesWaiting = 0;
+    float nearPlayerMinX = 0.0f;
+    float nearPlayerMaxX = 0.0f;
+    float nearPlayerMinY = 0.0f;
+    float nearPlayerMaxY = 0.0f;
+    uint32_t summonsRemaining = 0;                  // adds a boss still has to summon
+    uint32_t summoner = 0;                          // the boss summoning them, creatures that aren't summons are never removed so the index is stable
+
+    bool isWaveActive = false;
+    SimWaveTrigger waveTrigger = SIM_WAVE_NONE;
+    uint64_t waveStartMs = 0;
+    double waveCpuNs = 0;
+};
+
+class SimWave
+{
+public:
+    SimWaveTrigger trigger = SIM_WAVE_NONE;
+    uint64_t latencyMs = 0;
+    double cpuNs = 0;
+    bool superseded = false;                        // a new wave started before this one finished
+};
+
+class SimStats
+{
+public:
+    uint64_t hookCalls[SIM_HOOK_COUNT] = {};
+    uint64_t rescalesPerformed = 0;
+    uint64_t rescalesDeferred = 0;
+    uint64_t rescalesAvoided = 0;
+    uint64_t proximityChecks = 0;                   // GetCreaturePlayerProximity calls
+    uint64_t playerDistanceChecks = 0;              // creature to player distance checks made by them
+    uint64_t boundsCollections = 0;                 // CollectNearPlayerBounds calls
+    uint64_t summonProfileHits = 0;                 // summons resolved from an earlier summon's profile
+    uint64_t summonStatReuses = 0;                  // stat passes that reused a profile's stat inputs
+    double hookCpuNs = 0;
+    double summonSpawnCpuNs = 0;                    // OnBeforeCreatureSelectLevel and OnCreatureAddWorld of summons
+    std::vector<SimWave> waves;
+    std::vector<double> reloadNs;
+};
+
+static SimSettings settings;
+static SimStats stats;
+static DungeonScaleEngineConfig engineConfig;
+static uint64_t globalConfigTime = 2;
+static uint64_t lastConfigTime = 2;
+static std::mt19937 rng;
+
+static uint64_t GetNextConfigTime()
+{
+    return ++lastConfigTime;
+}
+
+static float RandomFloat()
+{
+    return std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
+}
+
+static bool RandomChance(float chancePerSecond)
+{
+    return RandomFloat() < chancePerSecond * settings.tickMs / 1000.0f;
+}
+
+// the same kind of overrides a tuned server ships with, for the maps in the default mix
+static void LoadConfig()
+{
+    DungeonScaleEngineConfig config;
+
+    config.dungeonOverrides = LoadInflectionPointOverrides("229 0.4 0.0 1.5, 309 -1 0.0 1.1, 48 0.3, 533 0.6");
+    config.bossOverrides = LoadInflectionPointOverrides("229 1.2, 309 1.5, 48 1.25, 603 1.3");
+    config.statModifierOverrides = LoadStatModifierOverrides("409 1.0 0.8 0.8 1.0 1.2 1.0, 568 -1 -1 -1 -1 1.35, 43 -1 1.2 1.2");
+    config.statModifierBossOverrides = LoadStatModifierOverrides("409 1.0 0.8 0.8 1.0 1.2 0.8, 533 -1 1.5");
+    config.statModifierCreatureOverrides = LoadStatModifierOverrides("14507 1.0 0.8 0.8 1.0 1.2 0.5, 11372 -1 -1 -1 -1 1.35, 15928 -1 1.2 1.2");
+    config.rewardScalingExceptionItemIDs = ParseIntsFromString("8444, 11078, 11197, 11602, 11885, 13302, 13303, 13304, 13305, 13306, 13307, 21761, 21762, 30436, 30437, 31088, 37372, 43151, 43158, 49351, 49352, 49635");
+
+    engineConfig = std::move(config);
+}
+
+//
+// Wave tracking
+//
+
+static void EndWave(SimInstance& instance, uint64_t nowMs, bool superseded)
+{
+    SimWave wave;
+    wave.trigger = instance.waveTrigger;
+    wave.latencyMs = nowMs - instance.waveStartMs;
+    wave.cpuNs = instance.waveCpuNs;
+    wave.superseded = superseded;
+    stats.waves.push_back(wave);
+
+    instance.isWaveActive = false;
+}
+
+static void StartWave(SimInstance& instance, SimWaveTrigger trigger, uint64_t nowMs)
+{
+    if (instance.isWaveActive)
+        EndWave(instance, nowMs, true);
+
+    instance.isWaveActive = true;
+    instance.waveTrigger = trigger;
+    instance.waveStartMs = nowMs;
+    instance.waveCpuNs = 0;
+}
+
+// a wave is over once no living creature is left waiting for its turn; deferred creatures wait for a player instead
+static bool IsWaveComplete(SimInstance const& instance)
+{
+    SimMapInfo const* mapInfo = instance.customData.Get<SimMapInfo>("DungeonScaleMapInfo");
+
+    for (SimCreature const& creature : instance.creatures)
+    {
+        SimCreatureInfo const* creatureInfo = creature.customData.Get<SimCreatureInfo>("DungeonScaleCreatureInfo");
+        if (creature.isAlive && (!creatureInfo || (!creatureInfo->isRescaleDeferred && creatureInfo->mapConfigTime < mapInfo->mapConfigTime)))
+            return false;
+    }
+
+    return true;
+}
+
+//
+// Hook bodies, see DungeonScale.cpp
+//
+
+static void UpdateMapPlayerStats(SimInstance& instance, uint64_t nowMs)
+{
+    uint8_t oldPlayerCount = instance.playerCount;
+    uint8_t oldAdjustedPlayerCount = instance.map.adjustedPlayerCount;
+
+    instance.playerCount = instance.players ? instance.players : 1;
+
+    uint8_t adjustedPlayerCount = CalculateAdjustedPlayerCount(engineConfig, instance.playerCount, oldPlayerCount, instance.minPlayers, 0,
+                                                               instance.combatLocked, instance.combatLockMinPlayers);
+
+    instance.map.adjustedPlayerCount = ApplyPlayerCountChangeDelay(engineConfig, adjustedPlayerCount, oldAdjustedPlayerCount, false, nowMs,
+                                                                   instance.pendingAdjustedPlayerCount, instance.pendingAdjustedPlayerCountTime);
+
+    if (oldAdjustedPlayerCount != instance.map.adjustedPlayerCount)
+    {
+        instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo")->mapConfigTime = 1;
+        instance.staleTrigger = SIM_WAVE_PLAYER_COUNT;
+    }
+}
+
+static void UpdateMapDataIfNeeded(SimInstance& instance, uint64_t nowMs)
+{
+    SimMapInfo* mapInfo = instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+
+    if (IsPendingPlayerCountChangeDue(engineConfig, instance.pendingAdjustedPlayerCount, instance.map.adjustedPlayerCount,
+                                      instance.pendingAdjustedPlayerCountTime, nowMs))
+    {
+        UpdateMapPlayerStats(instance, nowMs);
+    }
+
+    if (mapInfo->globalConfigTime >= globalConfigTime && mapInfo->mapConfigTime >= mapInfo->globalConfigTime)
+        return;
+
+    ++stats.hookCalls[SIM_HOOK_UPDATE_MAP_DATA];
+
+    if (mapInfo->globalConfigTime < globalConfigTime)
+    {
+        instance.combatLockMinPlayers = 0;
+        instance.staleTrigger = mapInfo->globalConfigTime == 1 ? SIM_WAVE_MAP_CREATED : SIM_WAVE_CONFIG_RELOAD;
+    }
+
+    UpdateMapPlayerStats(instance, nowMs);
+
+    mapInfo->globalConfigTime = globalConfigTime;
+    mapInfo->mapConfigTime = GetNextConfigTime();
+    mapInfo->summonProfiles.clear();
+
+    StartWave(instance, instance.staleTrigger, nowMs);
+}
+
+// the route snakes through the instance in lanes, like most dungeon layouts
+static SimPoint GetRoutePoint(SimInstance const& instance, float position)
+{
+    float const laneLength = 600.0f;
+    float const laneSpacing = 250.0f;
+
+    float distance = position * instance.routeLength;
+    uint32_t lane = uint32_t(distance / laneLength);
+    float alongLane = distance - lane * laneLength;
+
+    SimPoint point;
+    point.x = lane % 2 ? laneLength - alongLane : alongLane;
+    point.y = lane * laneSpacing;
+    return point;
+}
+
+enum SimProximity : uint8_t
+{
+    SIM_PROXIMITY_NONE = 0,
+    SIM_PROXIMITY_IN_RANGE,
+    SIM_PROXIMITY_CLOSE
+};
+
+static void CollectNearPlayerBounds(SimInstance& instance)
+{
+    ++stats.boundsCollections;
+
+    instance.nearPlayerMinX = instance.nearPlayerMinY = std::numeric_limits<float>::max();
+    instance.nearPlayerMaxX = instance.nearPlayerMaxY = std::numeric_limits<float>::lowest();
+
+    for (SimPoint const& playerPoint : instance.playerPoints)
+    {
+        instance.nearPlayerMinX = std::min(instance.nearPlayerMinX, playerPoint.x - SIM_VISIBILITY_RANGE);
+        instance.nearPlayerMaxX = std::max(instance.nearPlayerMaxX, playerPoint.x + SIM_VISIBILITY_RANGE);
+        instance.nearPlayerMinY = std::min(instance.nearPlayerMinY, playerPoint.y - SIM_VISIBILITY_RANGE);
+        instance.nearPlayerMaxY = std::max(instance.nearPlayerMaxY, playerPoint.y + SIM_VISIBILITY_RANGE);
+    }
+}
+
+static float GetDistance(SimPoint const& creaturePoint, SimPoint const& playerPoint)
+{
+    float dx = creaturePoint.x - playerPoint.x;
+    float dy = creaturePoint.y - playerPoint.y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+static SimProximity GetCreaturePlayerProximity(SimInstance const& instance, SimCreature const& creature)
+{
+    ++stats.proximityChecks;
+
+    if (!settings.exactDistanceCheck && (
+        creature.point.x < instance.nearPlayerMinX || creature.point.x > instance.nearPlayerMaxX ||
+        creature.point.y < instance.nearPlayerMinY || creature.point.y > instance.nearPlayerMaxY))
+        return SIM_PROXIMITY_NONE;
+
+    SimProximity proximity = SIM_PROXIMITY_NONE;
+
+    for (SimPoint const& playerPoint : instance.playerPoints)
+    {
+        ++stats.playerDistanceChecks;
+
+        float distance = GetDistance(creature.point, playerPoint);
+
+        if (distance <= SIM_VISIBILITY_RANGE / 2)
+            return SIM_PROXIMITY_CLOSE;
+
+        if (distance <= SIM_VISIBILITY_RANGE)
+            proximity = SIM_PROXIMITY_IN_RANGE;
+    }
+
+    return proximity;
+}
+
+static bool IsCreatureRescaleDue(SimInstance& instance, SimCreature& creature, SimCreatureInfo* creatureInfo, uint64_t nowMs)
+{
+    if (creature.isInCombat)
+        return true;
+
+    if (!settings.rescaleDeferDistant && !settings.rescaleMaxPerTick)
+        return true;
+
+    if (instance.rescaleTickTime != nowMs)
+    {
+        instance.rescaleTickTime = nowMs;
+        instance.rescalesThisTick = 0;
+        instance.closeRescalesWaiting = instance.closeRescalesRefused;
+        instance.closeRescalesRefused = 0;
+
+        CollectNearPlayerBounds(instance);
+    }
+
+    SimProximity proximity = GetCreaturePlayerProximity(instance, creature);
+
+    if (settings.rescaleDeferDistant && !proximity)
+    {
+        if (!creatureInfo->isRescaleDeferred)
+        {
+            creatureInfo->isRescaleDeferred = true;
+            ++stats.rescalesDeferred;
+        }
+
+        return false;
+    }
+
+    if (!settings.rescaleMaxPerTick)
+        return true;
+
+    if (instance.rescalesThisTick >= settings.rescaleMaxPerTick)
+    {
+        if (proximity == SIM_PROXIMITY_CLOSE)
+            ++instance.closeRescalesRefused;
+
+        return false;
+    }
+
+    if (proximity != SIM_PROXIMITY_CLOSE && instance.closeRescalesWaiting)
+        return false;
+
+    ++instance.rescalesThisTick;
+    return true;
+}
+
+static bool IsCreatureRelevant(SimCreature& creature)
+{
+    SimCreatureInfo* creatureInfo = creature.customData.Get<SimCreatureInfo>("DungeonScaleCreatureInfo");
+    if (!creatureInfo)
+        creatureInfo = creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo");
+
+    return creatureInfo->isRelevant;
+}
+
+static bool ResetCreatureIfNeeded(SimInstance& instance, SimCreature& creature, uint64_t nowMs)
+{
+    if (!IsCreatureRelevant(creature))
+        return false;
+
+    SimMapInfo* mapInfo = instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+    SimCreatureInfo* creatureInfo = creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo");
+
+    if (!creature.isAlive)
+    {
+        if (creatureInfo->mapConfigTime == 1)
+            return false;
+
+        creatureInfo->mapConfigTime = 1;
+
+        if (creatureInfo->isRescaleDeferred)
+        {
+            creatureInfo->isRescaleDeferred = false;
+            ++stats.rescalesAvoided;
+        }
+
+        return false;
+    }
+
+    if (creatureInfo->mapConfigTime < mapInfo->mapConfigTime && IsCreatureRescaleDue(instance, creature, creatureInfo, nowMs))
+    {
+        creatureInfo->isRescaleDeferred = false;
+        ++stats.rescalesPerformed;
+        return true;
+    }
+
+    return false;
+}
+
+static uint64_t GetSummonProfileKey(SimCreature const& creature)
+{
+    return (uint64_t(creature.entry) << 32) | creature.summoner;
+}
+
+// the summon's profile if it is still valid for the map's current scaling, see _getSummonProfile
+static SimSummonProfile* GetSummonProfile(SimInstance const& instance, SimMapInfo* mapInfo, SimCreature const& creature, SimCreatureInfo const* creatureInfo)
+{
+    if (!settings.summonProfiles || !creature.isSummon)
+        return nullptr;
+
+    auto profileIterator = mapInfo->summonProfiles.find(GetSummonProfileKey(creature));
+    if (profileIterator == mapInfo->summonProfiles.end())
+        return nullptr;
+
+    SimSummonProfile* summonProfile = &profileIterator->second;
+    if (summonProfile->mapConfigTime != mapInfo->mapConfigTime ||
+        summonProfile->adjustedPlayerCount != instance.map.adjustedPlayerCount ||
+        summonProfile->unmodifiedLevel != creatureInfo->unmodifiedLevel)
+        return nullptr;
+
+    return summonProfile;
+}
+
+// the multipliers ModifyCreatureAttributes writes, the level pass of a brand new creature doesn't mark it as updated
+static void ModifyCreatureAttributes(SimInstance& instance, SimCreature& creature)
+{
+    ++stats.hookCalls[SIM_HOOK_MODIFY_CREATURE_ATTRIBUTES];
+
+    SimMapInfo* mapInfo = instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+    SimCreatureInfo* creatureInfo = creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo");
+
+    if (!creatureInfo->isBrandNew)
+        creatureInfo->mapConfigTime = mapInfo->mapConfigTime;
+
+    if (!creatureInfo->isBossResolved)
+    {
+        creatureInfo->isBoss = creature.isBoss;
+        creatureInfo->isBossResolved = true;
+    }
+
+    creatureInfo->selectedLevel = creatureInfo->unmodifiedLevel;
+
+    float defaultMultiplier;
+    DungeonScaleStatModifiers statModifiers;
+
+    // summons sharing a profile share their stat inputs as long as the map's scaling doesn't change
+    SimSummonProfile* summonProfile = GetSummonProfile(instance, mapInfo, creature, creatureInfo);
+    if (summonProfile && summonProfile->hasStats)
+    {
+        ++stats.summonStatReuses;
+        defaultMultiplier = summonProfile->defaultMultiplier;
+        statModifiers = summonProfile->statModifiers;
+    }
+    else
+    {
+        DungeonScaleCreatureDescriptor creatureDescriptor;
+        creatureDescriptor.entry = creature.entry;
+        creatureDescriptor.isBoss = creatureInfo->isBoss;
+        creatureDescriptor.creatureOverride = FindCreatureStatModifierOverride(engineConfig, creature.entry);
+
+        DungeonScaleInflectionPointSettings inflectionPointSettings = CalculateInflectionPointSettings(engineConfig, instance.map, creatureInfo->isBoss);
+        defaultMultiplier = CalculateDefaultMultiplier(instance.map, inflectionPointSettings);
+        statModifiers = CalculateStatModifiers(engineConfig, instance.map, &creatureDescriptor);
+
+        if (summonProfile)
+        {
+            summonProfile->defaultMultiplier = defaultMultiplier;
+            summonProfile->statModifiers = statModifiers;
+            summonProfile->hasStats = true;
+        }
+    }
+
+    creatureInfo->multipliers = CalculateCreatureMultipliers(engineConfig, defaultMultiplier, statModifiers, creature.hasMana);
+}
+
+static void OnAllCreatureUpdate(SimInstance& instance, SimCreature& creature, uint64_t nowMs)
+{
+    ++stats.hookCalls[SIM_HOOK_ON_ALL_CREATURE_UPDATE];
+
+    // dormant, nobody is in the map to notice
+    SimMapInfo const* mapInfo = instance.customData.Get<SimMapInfo>("DungeonScaleMapInfo");
+    if (mapInfo && mapInfo->isDormant)
+        return;
+
+    UpdateMapDataIfNeeded(instance, nowMs);
+
+    if (ResetCreatureIfNeeded(instance, creature, nowMs))
+        ModifyCreatureAttributes(instance, creature);
+}
+
+// summons take the level (and boss flag) of their summoner, see AddCreatureToMapCreatureList
+static void AddCreatureToMapCreatureList(SimInstance& instance, SimCreature& creature)
+{
+    // the module looks both records up here as well
+    instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+    SimCreatureInfo* creatureInfo = creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo");
+
+    creatureInfo->isBoss = creature.isBoss;
+    creatureInfo->unmodifiedLevel = creature.level;
+
+    if (creature.isSummon && creature.summoner < instance.creatures.size())
+    {
+        SimCreature const& summoner = instance.creatures[creature.summoner];
+        SimCreatureInfo const* summonerInfo = summoner.customData.Get<SimCreatureInfo>("DungeonScaleCreatureInfo");
+
+        creatureInfo->isBoss = creature.isBoss || summoner.isBoss;
+        creatureInfo->unmodifiedLevel = summonerInfo ? summonerInfo->unmodifiedLevel : summoner.level;
+    }
+
+    creatureInfo->isBossResolved = true;
+}
+
+static void RecordSummonProfile(SimInstance& instance, SimCreature const& creature, SimCreatureInfo const* creatureInfo, uint8_t spawnLevel)
+{
+    if (!settings.summonProfiles || !creature.isSummon || !creatureInfo->selectedLevel)
+        return;
+
+    SimMapInfo* mapInfo = instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+
+    SimSummonProfile& summonProfile = mapInfo->summonProfiles[GetSummonProfileKey(creature)];
+    summonProfile = SimSummonProfile();
+    summonProfile.mapConfigTime = mapInfo->mapConfigTime;
+    summonProfile.adjustedPlayerCount = instance.map.adjustedPlayerCount;
+    summonProfile.spawnLevel = spawnLevel;
+    summonProfile.unmodifiedLevel = creatureInfo->unmodifiedLevel;
+    summonProfile.isBoss = creatureInfo->isBoss;
+}
+
+// see _applySummonProfile
+static bool ApplySummonProfile(SimInstance& instance, SimCreature& creature, SimCreatureInfo* creatureInfo, uint8_t spawnLevel)
+{
+    if (!settings.summonProfiles || !creature.isSummon)
+        return false;
+
+    SimMapInfo* mapInfo = instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo");
+
+    auto profileIterator = mapInfo->summonProfiles.find(GetSummonProfileKey(creature));
+    if (profileIterator == mapInfo->summonProfiles.end())
+        return false;
+
+    SimSummonProfile const& summonProfile = profileIterator->second;
+    if (summonProfile.mapConfigTime != mapInfo->mapConfigTime ||
+        summonProfile.adjustedPlayerCount != instance.map.adjustedPlayerCount ||
+        summonProfile.spawnLevel != spawnLevel)
+        return false;
+
+    creatureInfo->unmodifiedLevel = summonProfile.unmodifiedLevel;
+
+    if (!IsCreatureRelevant(creature))
+        return false;
+
+    creatureInfo->selectedLevel = summonProfile.unmodifiedLevel;
+    creatureInfo->isBoss = summonProfile.isBoss;
+    creatureInfo->isBossResolved = true;
+
+    ++stats.summonProfileHits;
+    return true;
+}
+
+// a new summon picks its level before it is added to the world
+static void OnBeforeCreatureSelectLevel(SimInstance& instance, SimCreature& creature, uint64_t nowMs)
+{
+    ++stats.hookCalls[SIM_HOOK_ON_BEFORE_CREATURE_SELECT_LEVEL];
+
+    SimCreatureInfo* creatureInfo = creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo");
+    creatureInfo->isBrandNew = true;
+
+    UpdateMapDataIfNeeded(instance, nowMs);
+
+    uint8_t spawnLevel = creature.level;
+    if (ApplySummonProfile(instance, creature, creatureInfo, spawnLevel))
+        return;
+
+    AddCreatureToMapCreatureList(instance, creature);
+    UpdateMapDataIfNeeded(instance, nowMs);
+
+    // the initial modification run, the level is all that is used of it
+    ModifyCreatureAttributes(instance, creature);
+
+    if (IsCreatureRelevant(creature))
+        RecordSummonProfile(instance, creature, creatureInfo, spawnLevel);
+}
+
+static void OnCreatureAddWorld(SimInstance& instance, SimCreature&& creature)
+{
+    ++stats.hookCalls[SIM_HOOK_ON_CREATURE_ADD_WORLD];
+
+    if (SimCreatureInfo* creatureInfo = creature.customData.Get<SimCreatureInfo>("DungeonScaleCreatureInfo"))
+        creatureInfo->isBrandNew = false;
+
+    instance.creatures.push_back(std::move(creature));
+}
+
+static void OnCreatureRemoveWorld(SimInstance& instance, size_t creatureIndex)
+{
+    ++stats.hookCalls[SIM_HOOK_ON_CREATURE_REMOVE_WORLD];
+
+    SimCreatureInfo const* creatureInfo = instance.creatures[creatureIndex].customData.Get<SimCreatureInfo>("DungeonScaleCreatureInfo");
+    if (creatureInfo && creatureInfo->isRescaleDeferred)
+        ++stats.rescalesAvoided;
+
+    instance.creatures[creatureIndex] = std::move(instance.creatures.back());
+    instance.creatures.pop_back();
+}
+
+static void OnPlayerEnterAll(SimInstance& instance, uint64_t nowMs)
+{
+    ++stats.hookCalls[SIM_HOOK_ON_PLAYER_ENTER_ALL];
+    ++instance.players;
+    instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo")->isDormant = false;
+    UpdateMapPlayerStats(instance, nowMs);
+}
+
+static void OnPlayerLeaveAll(SimInstance& instance, uint64_t nowMs)
+{
+    ++stats.hookCalls[SIM_HOOK_ON_PLAYER_LEAVE_ALL];
+    --instance.players;
+    instance.customData.GetDefault<SimMapInfo>("DungeonScaleMapInfo")->isDormant = !instance.players;
+    UpdateMapPlayerStats(instance, nowMs);
+}
+
+static void OnPlayerEnterCombat(SimInstance& instance)
+{
+    stats.hookCalls[SIM_HOOK_ON_PLAYER_ENTER_COMBAT] += instance.players;
+    instance.combatLocked = true;
+}
+
+static void OnPlayerLeaveCombat(SimInstance& instance, uint64_t nowMs)
+{
+    stats.hookCalls[SIM_HOOK_ON_PLAYER_LEAVE_COMBAT] += instance.players;
+    instance.combatLocked = false;
+    instance.combatLockMinPlayers = 0;
+    UpdateMapPlayerStats(instance, nowMs);
+}
+
+//
+// Instance lifecycle
+//
+
+static SimInstance CreateInstance(uint32_t mapId, uint32_t maxPlayers, bool isHeroic, uint32_t creatureCount, uint32_t bossCount)
+{
+    SimInstance instance;
+    instance.map.mapId = mapId;
+    instance.map.maxPlayers = maxPlayers;
+    instance.map.isHeroic = isHeroic;
+    instance.map.adjustedPlayerCount = 0;
+    instance.groupPosition = RandomFloat();
+    instance.routeLength = creatureCount * 10.0f;
+
+    for (uint32_t i = 0; i < creatureCount; ++i)
+    {
+        SimCreature creature;
+        creature.entry = 1000 + std::uniform_int_distribution<uint32_t>(0, 400)(rng);
+        creature.position = (float)i / creatureCount;
+        creature.point = GetRoutePoint(instance, creature.position);
+        creature.point.x += RandomFloat() * 30.0f - 15.0f;
+        creature.point.y += RandomFloat() * 30.0f - 15.0f;
+        creature.level = uint8_t(60 + std::uniform_int_distribution<uint32_t>(0, 3)(rng));
+        creature.isBoss = bossCount && i % (creatureCount / bossCount) == creatureCount / bossCount - 1;
+        creature.hasMana = creature.isBoss || RandomFloat() < 0.3f;
+
+        // a few well-known creatures with per-creature overrides
+        if (creature.isBoss && i % 3 == 0)
+            creature.entry = 14507;
+
+        creature.customData.GetDefault<SimCreatureInfo>("DungeonScaleCreatureInfo")->unmodifiedLevel = creature.level;
+
+        OnCreatureAddWorld(instance, std::move(creature));
+    }
+
+    // groups start at various sizes
+    uint32_t startingPlayers = std::uniform_int_distribution<uint32_t>(std::max(1u, maxPlayers / 2), maxPlayers)(rng);
+    for (uint32_t i = 0; i < startingPlayers; ++i)
+        OnPlayerEnterAll(instance, 0);
+
+    return instance;
+}
+
+static std::vector<SimInstance> CreateInstances()
+{
+    // realistic mix for a mid-size realm: mostly 5-man, some raids; spawn counts from the actual instances
+    struct InstanceMix { uint32_t count, mapId, maxPlayers; bool isHeroic; uint32_t creatureCount, bossCount; };
+    static InstanceMix const mix[] =
+    {
+        { 20,  36,  5, false, 150,  5 },            // The Deadmines
+        { 10, 574,  5, true,  130,  3 },            // Utgarde Keep
+        {  4, 309, 20, false, 280, 10 },            // Zul'Gurub
+        {  4, 533, 10, false, 420, 15 },            // Naxxramas
+        {  3, 603, 25, true,  380, 14 },            // Ulduar
+        {  2, 409, 40, false, 350, 10 },            // Molten Core
+    };
+
+    std::vector<SimInstance> instances;
+    for (InstanceMix const& entry : mix)
+        for (uint32_t i = 0; i < entry.count * settings.instancesScale; ++i)
+            instances.push_back(CreateInstance(entry.mapId, entry.maxPlayers, entry.isHeroic, entry.creatureCount, entry.bossCount));
+
+    return instances;
+}
+
+// the group spreads out a little around its spot on the route
+static void UpdatePlayerPoints(SimInstance& instance)
+{
+    SimPoint groupPoint = GetRoutePoint(instance, instance.groupPosition);
+
+    instance.playerPoints.resize(instance.players);
+    for (SimPoint& playerPoint : instance.playerPoints)
+    {
+        playerPoint.x = groupPoint.x + RandomFloat() * 40.0f - 20.0f;
+        playerPoint.y = groupPoint.y + RandomFloat() * 40.0f - 20.0f;
+    }
+}
+
+// players, pulls, summon storms, deaths and respawns for one tick
+static void SimulateInstanceEvents(SimInstance& instance, uint64_t nowMs)
+{
+    bool isInCombat = instance.combatLocked;
+
+    // players join and leave, also mid-combat
+    if (RandomChance(0.02f))
+    {
+        if (instance.players < instance.map.maxPlayers && (RandomFloat() < 0.5f || !instance.players))
+            OnPlayerEnterAll(instance, nowMs);
+        else if (instance.players)
+            OnPlayerLeaveAll(instance, nowMs);
+    }
+
+    // the whole group occasionally leaves and comes back later
+    if (instance.players && !isInCombat && RandomChance(0.001f))
+    {
+        while (instance.players)
+            OnPlayerLeaveAll(instance, nowMs);
+    }
+    else if (!instance.players && RandomChance(0.02f))
+    {
+        uint32_t returningPlayers = std::uniform_int_distribution<uint32_t>(1, instance.map.maxPlayers)(rng);
+        for (uint32_t i = 0; i < returningPlayers; ++i)
+            OnPlayerEnterAll(instance, nowMs);
+    }
+
+    if (!instance.players)
+        return;
+
+    if (!isInCombat)
+    {
+        // move along the route, respawning the instance at the end of it
+        instance.groupPosition += 3.0f * settings.tickMs / 1000.0f / instance.routeLength;
+        if (instance.groupPosition >= 1.0f)
+        {
+            instance.groupPosition = 0.0f;
+            for (SimCreature& creature : instance.creatures)
+                creature.isAlive = true;
+        }
+
+        // pull the next pack
+        if (RandomChance(0.1f))
+        {
+            bool pulled = false;
+            for (size_t i = 0; i < instance.creatures.size(); ++i)
+            {
+                SimCreature& creature = instance.creatures[i];
+                if (creature.isAlive && creature.position >= instance.groupPosition && creature.position < instance.groupPosition + 0.02f)
+                {
+                    creature.isInCombat = true;
+                    pulled = true;
+
+                    // some bosses call for help
+                    if (creature.isBoss && RandomFloat() < 0.5f)
+                    {
+                        instance.summonsRemaining = std::uniform_int_distribution<uint32_t>(20, 40)(rng);
+                        instance.summoner = uint32_t(i);
+                    }
+                }
+            }
+
+            if (pulled)
+                OnPlayerEnterCombat(instance);
+        }
+
+        return;
+    }
+
+    // summon storm, a few adds per tick, from a handful of entries per boss
+    for (uint32_t i = 0; i < 4 && instance.summonsRemaining; ++i, --instance.summonsRemaining)
+    {
+        SimCreature summon;
+        summon.entry = 5000 + instance.summoner % 8 * 4 + std::uniform_int_distribution<uint32_t>(0, 3)(rng);
+        summon.level = instance.creatures[instance.summoner].level;
+        summon.summoner = instance.summoner;
+        summon.position = instance.groupPosition;
+        summon.point = GetRoutePoint(instance, instance.groupPosition);
+        summon.isSummon = true;
+        summon.isInCombat = true;
+
+        // only the hooks are timed, the stand-in's construction isn't
+        auto spawnStart = Clock::now();
+        OnBeforeCreatureSelectLevel(instance, summon, nowMs);
+        OnCreatureAddWorld(instance, std::move(summon));
+        stats.summonSpawnCpuNs += std::chrono::duration<double, std::nano>(Clock::now() - spawnStart).count();
+    }
+
+    // creatures die, dead summons leave the world after a while
+    bool anyInCombat = instance.summonsRemaining;
+    for (size_t i = 0; i < instance.creatures.size(); )
+    {
+        SimCreature& creature = instance.creatures[i];
+
+        if (creature.isInCombat && RandomChance(creature.isBoss ? 0.02f : 0.15f))
+        {
+            creature.isInCombat = false;
+            creature.isAlive = false;
+            creature.despawnTimeMs = nowMs + 5000;
+        }
+
+        if (creature.isSummon && !creature.isAlive && nowMs >= creature.despawnTimeMs)
+        {
+            OnCreatureRemoveWorld(instance, i);
+            continue;
+        }
+
+        anyInCombat |= creature.isInCombat;
+        ++i;
+    }
+
+    if (!anyInCombat)
+        OnPlayerLeaveCombat(instance, nowMs);
+}
+
+static void ReloadConfig()
+{
+    auto start = Clock::now();
+
+    LoadConfig();
+    globalConfigTime = GetNextConfigTime();
+
+    stats.reloadNs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+}
+
+//
+// Reporting
+//
+
+template <typename T>
+static T Percentile(std::vector<T> values, double percentile)
+{
+    if (values.empty())
+        return T();
+
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t)(percentile / 100.0 * values.size()))];
+}
+
+static void PrintReport(std::vector<SimInstance> const& instances, double wallSeconds)
+{
+    size_t creatureCount = 0;
+    for (SimInstance const& instance : instances)
+        creatureCount += instance.creatures.size();
+
+    uint64_t totalHookCalls = 0;
+    for (uint64_t calls : stats.hookCalls)
+        totalHookCalls += calls;
+
+    printf("Simulated %us of %zu instances (%zu creatures at the end) in %.2fs wall time, %.1fx real time\n\n",
+        settings.seconds, instances.size(), creatureCount, wallSeconds, settings.seconds / wallSeconds);
+
+    printf("Hook calls                               %14s %14s\n", "total", "per sim second");
+    for (uint8_t hook = 0; hook < SIM_HOOK_COUNT; ++hook)
+        printf("  %-38s %14llu %14.0f\n", simHookNames[hook], (unsigned long long)stats.hookCalls[hook], stats.hookCalls[hook] / (double)settings.seconds);
+
+    printf("  %-38s %14llu\n", "all", (unsigned long long)totalHookCalls);
+
+    // only the creature update walk is timed, it is where nearly all of the calls and the rescale work are
+    printf("\nCreature update walk: %.0f OnAllCreatureUpdate calls per CPU second, %.2f%% of one core at real time\n",
+        stats.hookCalls[SIM_HOOK_ON_ALL_CREATURE_UPDATE] / (stats.hookCpuNs / 1e9), 100.0 * stats.hookCpuNs / 1e9 / settings.seconds);
+    printf("  (the module's hook bodies alone, single-threaded, against stand-in objects; the core's own creature updates,\n"
+           "   AI, movement, grid visits and packets are not included)\n");
+    printf("\n");
+
+    uint64_t summonSpawns = stats.hookCalls[SIM_HOOK_ON_BEFORE_CREATURE_SELECT_LEVEL];
+    printf("Summon spawns: %llu, %.0f per CPU second, %.0f ns each (summon profiles %s, %llu resolved from a profile, %llu stat passes reused one)\n",
+        (unsigned long long)summonSpawns,
+        summonSpawns / (stats.summonSpawnCpuNs / 1e9),
+        summonSpawns ? stats.summonSpawnCpuNs / summonSpawns : 0.0,
+        settings.summonProfiles ? "on" : "off",
+        (unsigned long long)stats.summonProfileHits,
+        (unsigned long long)stats.summonStatReuses);
+    printf("\n");
+
+    printf("Rescales performed | deferred | never needed: %llu | %llu | %llu\n",
+        (unsigned long long)stats.rescalesPerformed, (unsigned long long)stats.rescalesDeferred, (unsigned long long)stats.rescalesAvoided);
+    printf("Player proximity checks: %llu, %llu player distance checks, %llu player bounds collections (%s)\n\n",
+        (unsigned long long)stats.proximityChecks, (unsigned long long)stats.playerDistanceChecks, (unsigned long long)stats.boundsCollections,
+        settings.exactDistanceCheck ? "distance to every player" : "per-tick player bounds first");
+
+    printf("Rescale waves                  %8s %10s %10s %10s %10s %12s %12s %12s\n", "count", "superseded", "p50 ms", "p99 ms", "max ms", "p50 cpu us", "p99 cpu us", "max cpu us");
+    for (uint8_t trigger = SIM_WAVE_NONE + 1; trigger < SIM_WAVE_TRIGGER_COUNT; ++trigger)
+    {
+        std::vector<uint64_t> latencies;
+        std::vector<double> cpuUs;
+        uint32_t superseded = 0;
+
+        for (SimWave const& wave : stats.waves)
+        {
+            if (wave.trigger != trigger)
+                continue;
+
+            latencies.push_back(wave.latencyMs);
+            cpuUs.push_back(wave.cpuNs / 1000.0);
+            superseded += wave.superseded;
+        }
+
+        printf("  %-28s %8zu %10u %10llu %10llu %10llu %12.1f %12.1f %12.1f\n",
+            simWaveTriggerNames[trigger],
+            latencies.size(),
+            superseded,
+            (unsigned long long)Percentile(latencies, 50),
+            (unsigned long long)Percentile(latencies, 99),
+            (unsigned long long)Percentile(latencies, 100),
+            Percentile(cpuUs, 50),
+            Percentile(cpuUs, 99),
+            Percentile(cpuUs, 100)
+        );
+    }
+    printf("\n");
+
+    printf("Config reload (parse + publish): %zu reloads, p50 %.1f us, max %.1f us\n\n",
+        stats.reloadNs.size(), Percentile(stats.reloadNs, 50) / 1000.0, Percentile(stats.reloadNs, 100) / 1000.0);
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    printf("Peak heap: %.1f MiB, max RSS: %.1f MiB\n", peakHeapBytes / 1048576.0, usage.ru_maxrss / 1024.0);
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        auto nextValue = [&]() { return i + 1 < argc ? (uint32_t)strtoul(argv[++i], nullptr, 10) : 0u; };
+
+        if (!strcmp(argv[i], "--instances-scale"))
+            settings.instancesScale = std::max(1u, nextValue());
+        else if (!strcmp(argv[i], "--seconds"))
+            settings.seconds = nextValue();
+        else if (!strcmp(argv[i], "--tick-ms"))
+            settings.tickMs = std::max(1u, nextValue());
+        else if (!strcmp(argv[i], "--reload-every"))
+            settings.reloadEverySeconds = nextValue();
+        else if (!strcmp(argv[i], "--max-per-tick"))
+            settings.rescaleMaxPerTick = nextValue();
+        else if (!strcmp(argv[i], "--no-defer"))
+            settings.rescaleDeferDistant = false;
+        else if (!strcmp(argv[i], "--exact-distance-check"))
+            settings.exactDistanceCheck = true;
+        else if (!strcmp(argv[i], "--no-summon-profiles"))
+            settings.summonProfiles = false;
+        else if (!strcmp(argv[i], "--seed"))
+            settings.seed = nextValue();
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    rng.seed(settings.seed);
+    LoadConfig();
+
+    std::vector<SimInstance> instances = CreateInstances();
+
+    auto start = Clock::now();
+
+    for (uint64_t nowMs = settings.tickMs; nowMs <= settings.seconds * 1000ull; nowMs += settings.tickMs)
+    {
+        if (settings.reloadEverySeconds && nowMs % (settings.reloadEverySeconds * 1000ull) < settings.tickMs)
+            ReloadConfig();
+
+        for (SimInstance& instance : instances)
+        {
+            SimulateInstanceEvents(instance, nowMs);
+            UpdatePlayerPoints(instance);
+
+            // only the hook work is timed, not the simulation around it
+            auto hookStart = Clock::now();
+            for (SimCreature& creature : instance.creatures)
+                OnAllCreatureUpdate(instance, creature, nowMs);
+            double hookNs = std::chrono::duration<double, std::nano>(Clock::now() - hookStart).count();
+
+            stats.hookCpuNs += hookNs;
+
+            if (instance.isWaveActive)
+            {
+                instance.waveCpuNs += hookNs;
+                if (IsWaveComplete(instance))
+                    EndWave(instance, nowMs, false);
+            }
+        }
+    }
+
+    PrintReport(instances, std::chrono::duration<double>(Clock::now() - start).count());
+
+    return 0;
+}